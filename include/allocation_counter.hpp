@@ -0,0 +1,243 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace cinter
+{
+
+// Number of heap allocations (and the bytes requested) made by the
+// current thread.  Only meaningful in a program that expands
+// CINTER_DEFINE_COUNTING_OPERATOR_NEW() in exactly one translation unit.
+struct allocation_stats
+{
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes         = 0;
+};
+
+namespace detail
+{
+
+// Plain (trivially initialized) thread_local so it is safe to touch from
+// inside operator new without recursing into the allocator.
+inline thread_local allocation_stats thread_allocation_stats;
+
+inline void count_allocation(std::size_t size) noexcept
+{
+    ++thread_allocation_stats.allocations;
+    thread_allocation_stats.bytes += size;
+}
+
+inline void count_deallocation() noexcept
+{
+    ++thread_allocation_stats.deallocations;
+}
+
+} // namespace detail
+
+// allocation_counter records the allocations made by the current thread
+// between its construction and a call to stats().  It is used to verify
+// that the cinter wrappers stay allocation free:
+//
+//     cinter::allocation_counter counter;
+//     auto v = cinter::safe_string{get_name()}.view();
+//     if (!cinter::check_allocations(stdout, "safe_string::view", counter.stats(), 0))
+//     {
+//         return EXIT_FAILURE;
+//     }
+class allocation_counter
+{
+    allocation_stats start_;
+
+public:
+    allocation_counter() noexcept : start_(detail::thread_allocation_stats) {}
+
+    allocation_counter(const allocation_counter& other) = delete;
+    allocation_counter& operator=(const allocation_counter& other) = delete;
+
+    void reset() noexcept { start_ = detail::thread_allocation_stats; }
+
+    [[nodiscard]] allocation_stats stats() const noexcept
+    {
+        const allocation_stats& now = detail::thread_allocation_stats;
+        allocation_stats delta;
+        delta.allocations   = now.allocations - start_.allocations;
+        delta.deallocations = now.deallocations - start_.deallocations;
+        delta.bytes         = now.bytes - start_.bytes;
+        return delta;
+    }
+};
+
+// Runs fn() and returns the allocations it made on the calling thread.
+template <typename Fn>
+[[nodiscard]] allocation_stats measure_allocations(Fn&& fn)
+{
+    allocation_counter counter;
+    fn();
+    return counter.stats();
+}
+
+namespace detail
+{
+
+// Writes s as the contents of a JSON string: quotes, backslashes and
+// control characters are escaped, other bytes are copied as they are.
+inline void write_json_string(std::FILE* out, const char* s)
+{
+    for (; s && *s; ++s)
+    {
+        const unsigned char c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\')
+        {
+            std::fputc('\\', out);
+            std::fputc(c, out);
+        }
+        else if (c < 0x20)
+        {
+            std::fprintf(out, "\\u%04x", c);
+        }
+        else
+        {
+            std::fputc(c, out);
+        }
+    }
+}
+
+} // namespace detail
+
+// Writes one JSON object per line so that reports can be collected and
+// diffed by tooling.  Does not allocate.
+inline void write_allocation_report(std::FILE* out, const char* operation, const allocation_stats& stats)
+{
+    std::fputs("{\"operation\":\"", out);
+    detail::write_json_string(out, operation);
+    std::fprintf(out,
+                 "\",\"allocations\":%zu,\"deallocations\":%zu,\"bytes\":%zu}\n",
+                 stats.allocations,
+                 stats.deallocations,
+                 stats.bytes);
+}
+
+// Reports the stats and returns false if more than max_allocations were made.
+// Test programs should turn a false result into a non-zero exit code so a
+// regression that adds an allocation to a hot path fails the build.
+inline bool check_allocations(std::FILE* out,
+                              const char* operation,
+                              const allocation_stats& stats,
+                              std::size_t max_allocations)
+{
+    write_allocation_report(out, operation, stats);
+    return stats.allocations <= max_allocations;
+}
+
+} // namespace cinter
+
+#ifdef _WIN32
+#define CINTER_DETAIL_ALIGNED_ALLOC(size, align) _aligned_malloc((size), (align))
+#define CINTER_DETAIL_ALIGNED_FREE(ptr) _aligned_free(ptr)
+#else
+#define CINTER_DETAIL_ALIGNED_ALLOC(size, align)                                                                      \
+    std::aligned_alloc((align), ((size) + (align) - 1) / (align) * (align))
+#define CINTER_DETAIL_ALIGNED_FREE(ptr) std::free(ptr)
+#endif
+
+// GCC 11+ flags free() in a replacement operator delete as mismatched with
+// the replaced operator new even though both are defined together here.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#define CINTER_DETAIL_PUSH_NEW_DELETE_WARNINGS                                                                         \
+    _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wmismatched-new-delete\"")
+#define CINTER_DETAIL_POP_NEW_DELETE_WARNINGS _Pragma("GCC diagnostic pop")
+#else
+#define CINTER_DETAIL_PUSH_NEW_DELETE_WARNINGS
+#define CINTER_DETAIL_POP_NEW_DELETE_WARNINGS
+#endif
+
+// Replaces the global operator new/delete family with versions that update
+// the per-thread counters above.  Replacement functions may only be defined
+// once per program, so expand this macro in exactly one translation unit
+// (normally the test or benchmark driver), never in a library.
+#define CINTER_DEFINE_COUNTING_OPERATOR_NEW()                                                                          \
+    CINTER_DETAIL_PUSH_NEW_DELETE_WARNINGS                                                                             \
+    void* operator new(std::size_t size)                                                                               \
+    {                                                                                                                  \
+        ::cinter::detail::count_allocation(size);                                                                      \
+        if (void* p = std::malloc(size ? size : 1))                                                                    \
+        {                                                                                                              \
+            return p;                                                                                                  \
+        }                                                                                                              \
+        throw std::bad_alloc{};                                                                                        \
+    }                                                                                                                  \
+    void* operator new[](std::size_t size) { return ::operator new(size); }                                            \
+    void* operator new(std::size_t size, const std::nothrow_t&) noexcept                                               \
+    {                                                                                                                  \
+        ::cinter::detail::count_allocation(size);                                                                      \
+        return std::malloc(size ? size : 1);                                                                           \
+    }                                                                                                                  \
+    void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return ::operator new(size, tag); }  \
+    void* operator new(std::size_t size, std::align_val_t align)                                                       \
+    {                                                                                                                  \
+        ::cinter::detail::count_allocation(size);                                                                      \
+        if (void* p = CINTER_DETAIL_ALIGNED_ALLOC(size ? size : 1, static_cast<std::size_t>(align)))                   \
+        {                                                                                                              \
+            return p;                                                                                                  \
+        }                                                                                                              \
+        throw std::bad_alloc{};                                                                                        \
+    }                                                                                                                  \
+    void* operator new[](std::size_t size, std::align_val_t align) { return ::operator new(size, align); }             \
+    void operator delete(void* p) noexcept                                                                             \
+    {                                                                                                                  \
+        if (p)                                                                                                         \
+        {                                                                                                              \
+            ::cinter::detail::count_deallocation();                                                                    \
+            std::free(p);                                                                                              \
+        }                                                                                                              \
+    }                                                                                                                  \
+    void operator delete[](void* p) noexcept { ::operator delete(p); }                                                 \
+    void operator delete(void* p, std::size_t) noexcept { ::operator delete(p); }                                      \
+    void operator delete[](void* p, std::size_t) noexcept { ::operator delete(p); }                                    \
+    void operator delete(void* p, const std::nothrow_t&) noexcept { ::operator delete(p); }                            \
+    void operator delete[](void* p, const std::nothrow_t&) noexcept { ::operator delete(p); }                          \
+    void operator delete(void* p, std::align_val_t) noexcept                                                           \
+    {                                                                                                                  \
+        if (p)                                                                                                         \
+        {                                                                                                              \
+            ::cinter::detail::count_deallocation();                                                                    \
+            CINTER_DETAIL_ALIGNED_FREE(p);                                                                             \
+        }                                                                                                              \
+    }                                                                                                                  \
+    void operator delete[](void* p, std::align_val_t align) noexcept { ::operator delete(p, align); }                  \
+    void operator delete(void* p, std::size_t, std::align_val_t align) noexcept { ::operator delete(p, align); }       \
+    void operator delete[](void* p, std::size_t, std::align_val_t align) noexcept { ::operator delete(p, align); }     \
+    CINTER_DETAIL_POP_NEW_DELETE_WARNINGS
@@ -0,0 +1,150 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace cinter
+{
+
+// basic_bounded_safe_string wraps a character array that is terminated by
+// the first null character *or* by a known bound, whichever comes first.
+// C APIs use such fields for fixed-size arrays (utsname::sysname) and for
+// names embedded in variable-length records (inotify_event::name,
+// linux_dirent64::d_name) where the terminator is not guaranteed to be
+// present.  As with basic_safe_string, a null pointer is an empty string.
+template <typename Char = char>
+class basic_bounded_safe_string
+{
+    const Char* ptr;
+    std::size_t bound;
+
+public:
+    constexpr basic_bounded_safe_string() noexcept : ptr(nullptr), bound(0) {}
+    constexpr basic_bounded_safe_string(const Char* src, std::size_t max_length) noexcept
+        : ptr(src)
+        , bound(src ? max_length : 0)
+    {}
+    // Implicit conversion from fixed-size arrays is desired
+    template <std::size_t N>
+    constexpr basic_bounded_safe_string(const Char (&array)[N]) noexcept : ptr(array), bound(N)
+    {}
+
+    constexpr basic_bounded_safe_string(const basic_bounded_safe_string& other) noexcept = default;
+    constexpr basic_bounded_safe_string(basic_bounded_safe_string&& other) noexcept = default;
+
+    ~basic_bounded_safe_string() noexcept = default;
+
+    basic_bounded_safe_string& operator=(const basic_bounded_safe_string& other) noexcept = default;
+    basic_bounded_safe_string& operator=(basic_bounded_safe_string&& other) noexcept = default;
+
+    [[nodiscard]] constexpr bool is_null() const {return !ptr;}
+    [[nodiscard]] explicit constexpr operator bool() const {return ptr != nullptr;}
+
+    // Number of characters before the terminator or the bound.
+    [[nodiscard]] constexpr std::size_t length() const noexcept
+    {
+        std::size_t len = 0;
+        while (len < bound && ptr[len] != Char{})
+        {
+            ++len;
+        }
+        return len;
+    }
+
+    [[nodiscard]] constexpr std::size_t max_length() const noexcept {return bound;}
+
+    // True if a terminator lies within the bound, i.e. the characters can be
+    // passed to a C API expecting a C-string.
+    [[nodiscard]] constexpr bool is_terminated() const noexcept {return length() < bound;}
+
+    // Returns the string as a basic_safe_string when it is terminated within
+    // the bound, and a null basic_safe_string otherwise.
+    [[nodiscard]] constexpr basic_safe_string<Char> safe() const noexcept
+    {
+        return is_terminated() ? basic_safe_string<Char>(ptr) : basic_safe_string<Char>();
+    }
+
+    [[nodiscard]] constexpr const Char* data() const noexcept {return ptr;}
+
+    [[nodiscard]] std::basic_string<Char> string() const {return std::basic_string<Char>(view());}
+    [[nodiscard]] explicit operator std::basic_string<Char>() const {return string();}
+
+    [[nodiscard]] constexpr std::basic_string_view<Char> view() const
+    {
+        return ptr ? std::basic_string_view<Char>(ptr, length()) : std::basic_string_view<Char>();
+    }
+    [[nodiscard]] explicit constexpr operator std::basic_string_view<Char>() const {return view();}
+
+    [[nodiscard]] constexpr bool operator==(const basic_bounded_safe_string& other) const noexcept
+    {
+        return view() == other.view();
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const basic_bounded_safe_string& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    [[nodiscard]] constexpr bool operator<(const basic_bounded_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) < 0;
+    }
+
+    [[nodiscard]] constexpr bool operator<=(const basic_bounded_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) <= 0;
+    }
+
+    [[nodiscard]] constexpr bool operator>(const basic_bounded_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) > 0;
+    }
+
+    [[nodiscard]] constexpr bool operator>=(const basic_bounded_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) >= 0;
+    }
+
+    using const_iterator = const Char*;
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return ptr; }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return ptr + length(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+};
+
+using bounded_safe_string   = basic_bounded_safe_string<char>;
+using bounded_safe_wstring  = basic_bounded_safe_string<wchar_t>;
+
+} // namespace cinter
@@ -0,0 +1,491 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "hash.hpp"
+#include "safe_string.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cinter
+{
+
+struct clock_cache_options
+{
+    // Budget for keys, values and bookkeeping across all shards.  An entry
+    // is charged sizeof its node plus its key plus the extra bytes given to
+    // insert().
+    std::size_t capacity_bytes = 1 << 20;
+    // Rounded up to a power of two; 0 means four per hardware thread.
+    std::size_t shard_count = 0;
+    // Lifetime of an entry; zero means entries never expire.
+    std::chrono::nanoseconds ttl{0};
+    // Lifetime of an entry whose value has_error(), e.g. a failed
+    // sentinel_result; zero means the same as ttl.
+    std::chrono::nanoseconds negative_ttl{0};
+};
+
+namespace detail
+{
+
+template <typename T, typename = void>
+struct has_error_member : std::false_type
+{
+};
+
+template <typename T>
+struct has_error_member<T, std::void_t<decltype(std::declval<const T&>().has_error())>> : std::true_type
+{
+};
+
+} // namespace detail
+
+/*
+clock_cache is a bounded, thread-safe cache for memoizing expensive C calls
+(realpath, getpwnam, getaddrinfo, parsing) keyed by strings.
+
+Lookups take a safe_string and allocate nothing: the key is hashed in the
+same pass that finds its terminator, the top hash bits pick a shard and the
+shard's open-addressing index is probed with the rest.  Only an insert
+copies the key.  Each shard has its own mutex.
+
+When a shard is over its share of capacity_bytes, entries are evicted with
+the CLOCK algorithm: a hand sweeps the entries, sparing (and clearing the
+reference bit of) those read since its last pass.  That approximates LRU
+while a hit only sets a bit.
+
+Entries may expire after options.ttl.  Values with a has_error() member,
+such as sentinel_result, are negative results and use options.negative_ttl,
+so a failed lookup can be cached for a shorter time than a successful one.
+Expired entries are dropped when a lookup reaches them, and the CLOCK hand
+evicts an expired entry it reaches whatever its reference bit.
+
+    using passwd_result = cinter::sentinel_result<uid_t, static_cast<uid_t>(-1), cinter::not_equal_to<uid_t>>;
+    cinter::clock_cache_options options;
+    options.ttl          = std::chrono::minutes(5);
+    options.negative_ttl = std::chrono::seconds(10);
+    cinter::clock_cache<passwd_result> uids(options);
+
+    passwd_result uid = uids.get_or_compute(name, [&] {
+        const passwd* p = getpwnam(name.c_str());
+        return passwd_result(p ? p->pw_uid : static_cast<uid_t>(-1));
+    });
+
+find() returns a copy of the value, so that eviction on another thread can
+never leave the caller with a dangling reference; cache large values as
+std::shared_ptr<const T>.
+*/
+template <typename Value>
+class clock_cache
+{
+    using clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t empty_slot = 0;
+    static constexpr std::size_t   min_slots  = 16;
+
+    struct node
+    {
+        std::unique_ptr<char[]> key;
+        std::size_t             length  = 0;
+        std::uint64_t           hash    = 0;
+        std::optional<Value>    value;
+        // steady_clock nanoseconds; zero for entries that do not expire.
+        std::int64_t            expires = 0;
+        std::size_t             charge  = 0;
+        bool                    referenced = false;
+    };
+
+    struct alignas(64) shard
+    {
+        std::mutex                 mutex;
+        std::vector<node>          nodes;
+        std::vector<std::uint32_t> free_nodes;
+        // Node index + 1, or empty_slot.  Linear probing; deletion shifts
+        // later entries back, so there are no tombstones.
+        std::vector<std::uint32_t> slots;
+        std::size_t                count = 0;
+        std::size_t                bytes = 0;
+        std::size_t                hand  = 0;
+    };
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t              shard_count_;
+    unsigned                 shard_shift_;
+    std::size_t              shard_budget_;
+    std::int64_t             ttl_;
+    std::int64_t             negative_ttl_;
+
+    [[nodiscard]] static std::int64_t now() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch()).count();
+    }
+
+    [[nodiscard]] shard& shard_for(std::uint64_t hash) const noexcept
+    {
+        return shards_[shard_shift_ == 64 ? 0 : static_cast<std::size_t>(hash >> shard_shift_)];
+    }
+
+    [[nodiscard]] static bool is_negative(const Value& value) noexcept
+    {
+        if constexpr (detail::has_error_member<Value>::value)
+        {
+            return value.has_error();
+        }
+        else
+        {
+            (void)value;
+            return false;
+        }
+    }
+
+    // Slot holding key, or slots.size() if it is absent.
+    [[nodiscard]] static std::size_t find_slot(const shard& s, const char* key, const hashed_length& hl) noexcept
+    {
+        if (s.slots.empty())
+        {
+            return 0;
+        }
+        const std::size_t mask = s.slots.size() - 1;
+        for (std::size_t i = hl.hash & mask;; i = (i + 1) & mask)
+        {
+            const std::uint32_t slot = s.slots[i];
+            if (slot == empty_slot)
+            {
+                return s.slots.size();
+            }
+            const node& n = s.nodes[slot - 1];
+            if (n.hash == hl.hash && n.length == hl.length && std::memcmp(n.key.get(), key, hl.length) == 0)
+            {
+                return i;
+            }
+        }
+    }
+
+    static void place(shard& s, std::uint32_t index) noexcept
+    {
+        const std::size_t mask = s.slots.size() - 1;
+        std::size_t i = s.nodes[index].hash & mask;
+        while (s.slots[i] != empty_slot)
+        {
+            i = (i + 1) & mask;
+        }
+        s.slots[i] = index + 1;
+    }
+
+    static void rehash(shard& s, std::size_t slot_count)
+    {
+        s.slots.assign(slot_count, empty_slot);
+        for (std::size_t i = 0; i < s.nodes.size(); ++i)
+        {
+            if (s.nodes[i].key)
+            {
+                place(s, static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    // Removes the entry in slot pos and moves later entries of the probe
+    // run back so that every entry stays reachable from its home slot.
+    static void remove(shard& s, std::size_t pos) noexcept
+    {
+        const std::size_t mask = s.slots.size() - 1;
+        const std::uint32_t index = s.slots[pos] - 1;
+        node& n = s.nodes[index];
+        s.bytes -= n.charge;
+        --s.count;
+        n.key.reset();
+        n.value.reset();
+        s.free_nodes.push_back(index);
+
+        s.slots[pos] = empty_slot;
+        for (std::size_t j = (pos + 1) & mask; s.slots[j] != empty_slot; j = (j + 1) & mask)
+        {
+            const std::size_t home = s.nodes[s.slots[j] - 1].hash & mask;
+            // Move the entry at j into the hole unless its home lies
+            // cyclically in (pos, j].
+            const bool reachable = pos <= j ? (pos < home && home <= j) : (pos < home || home <= j);
+            if (!reachable)
+            {
+                s.slots[pos] = s.slots[j];
+                s.slots[j]   = empty_slot;
+                pos          = j;
+            }
+        }
+    }
+
+    // Slot of the node at index.
+    [[nodiscard]] static std::size_t slot_of(const shard& s, std::uint32_t index) noexcept
+    {
+        const std::size_t mask = s.slots.size() - 1;
+        std::size_t i = s.nodes[index].hash & mask;
+        while (s.slots[i] != index + 1)
+        {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    // CLOCK: evicts the first entry, from the hand on, that has expired or
+    // has not been referenced since the hand last passed it.  t is the
+    // current time, or zero to read the clock when it is first needed.
+    static void evict_one(shard& s, std::int64_t& t) noexcept
+    {
+        for (;;)
+        {
+            if (s.hand >= s.nodes.size())
+            {
+                s.hand = 0;
+            }
+            node& n = s.nodes[s.hand];
+            const std::uint32_t index = static_cast<std::uint32_t>(s.hand++);
+            if (!n.key)
+            {
+                continue;
+            }
+            if (n.referenced && !expired(n, t))
+            {
+                n.referenced = false;
+                continue;
+            }
+            remove(s, slot_of(s, index));
+            return;
+        }
+    }
+
+    [[nodiscard]] static bool expired(const node& n, std::int64_t& t) noexcept
+    {
+        if (n.expires == 0)
+        {
+            return false;
+        }
+        if (t == 0)
+        {
+            t = now();
+        }
+        return n.expires <= t;
+    }
+
+public:
+    explicit clock_cache(const clock_cache_options& options = clock_cache_options())
+        : ttl_(options.ttl.count())
+        , negative_ttl_(options.negative_ttl.count() ? options.negative_ttl.count() : options.ttl.count())
+    {
+        std::size_t wanted = options.shard_count;
+        if (!wanted)
+        {
+            wanted = std::max(1u, std::thread::hardware_concurrency()) * std::size_t{4};
+        }
+        std::size_t n = 1;
+        unsigned bits = 0;
+        while (n < wanted)
+        {
+            n *= 2;
+            ++bits;
+        }
+        shards_.reset(new shard[n]);
+        shard_count_  = n;
+        shard_shift_  = 64 - bits;
+        shard_budget_ = options.capacity_bytes / n;
+    }
+
+    clock_cache(const clock_cache& other) = delete;
+    clock_cache& operator=(const clock_cache& other) = delete;
+
+    [[nodiscard]] std::size_t shard_count() const noexcept { return shard_count_; }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < shard_count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total += shards_[i].count;
+        }
+        return total;
+    }
+
+    // Bytes charged against capacity_bytes.
+    [[nodiscard]] std::size_t bytes() const
+    {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < shard_count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total += shards_[i].bytes;
+        }
+        return total;
+    }
+
+    // Returns a copy of the value cached for key, or nothing if it is
+    // absent or expired.
+    [[nodiscard]] std::optional<Value> find(safe_string key)
+    {
+        const char*         k  = key.c_str();
+        const hashed_length hl = hash_with_length(key);
+        shard&              s  = shard_for(hl.hash);
+        std::int64_t        t  = 0;
+
+        std::lock_guard<std::mutex> lock(s.mutex);
+        const std::size_t pos = find_slot(s, k, hl);
+        if (pos == s.slots.size())
+        {
+            return std::nullopt;
+        }
+        node& n = s.nodes[s.slots[pos] - 1];
+        if (expired(n, t))
+        {
+            remove(s, pos);
+            return std::nullopt;
+        }
+        n.referenced = true;
+        return n.value;
+    }
+
+    [[nodiscard]] bool contains(safe_string key)
+    {
+        return find(key).has_value();
+    }
+
+    // Caches value for key, replacing any previous value.  extra_bytes is
+    // charged in addition to the node and the key, e.g. for memory the
+    // value owns.  An entry larger than a shard's budget is not cached.
+    void insert(safe_string key, Value value, std::size_t extra_bytes = 0)
+    {
+        const char*         k  = key.c_str();
+        const hashed_length hl = hash_with_length(key);
+        shard&              s  = shard_for(hl.hash);
+        const std::size_t   charge = sizeof(node) + hl.length + 1 + extra_bytes;
+        const std::int64_t  ttl = is_negative(value) ? negative_ttl_ : ttl_;
+        std::int64_t        t   = ttl ? now() : 0;
+        const std::int64_t  expires = ttl ? t + ttl : 0;
+
+        std::lock_guard<std::mutex> lock(s.mutex);
+        const std::size_t pos = find_slot(s, k, hl);
+        if (pos != s.slots.size())
+        {
+            remove(s, pos);
+        }
+        if (charge > shard_budget_)
+        {
+            return;
+        }
+        while (s.bytes + charge > shard_budget_)
+        {
+            evict_one(s, t);
+        }
+        if ((s.count + 1) * 2 > s.slots.size())
+        {
+            rehash(s, s.slots.empty() ? min_slots : s.slots.size() * 2);
+        }
+
+        std::uint32_t index;
+        if (!s.free_nodes.empty())
+        {
+            index = s.free_nodes.back();
+            s.free_nodes.pop_back();
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(s.nodes.size());
+            s.nodes.emplace_back();
+        }
+        node& n = s.nodes[index];
+        n.key.reset(new char[hl.length + 1]);
+        std::memcpy(n.key.get(), k, hl.length);
+        n.key[hl.length] = '\0';
+        n.length     = hl.length;
+        n.hash       = hl.hash;
+        n.value.emplace(std::move(value));
+        n.expires    = expires;
+        n.charge     = charge;
+        n.referenced = false;
+        place(s, index);
+        ++s.count;
+        s.bytes += charge;
+    }
+
+    // Returns the cached value for key, or calls compute(), caches its
+    // result and returns it.  The lock is not held while compute() runs, so
+    // two threads missing on the same key may both compute it.
+    template <typename Fn>
+    Value get_or_compute(safe_string key, Fn&& compute)
+    {
+        if (std::optional<Value> cached = find(key))
+        {
+            return std::move(*cached);
+        }
+        Value value = std::forward<Fn>(compute)();
+        insert(key, value);
+        return value;
+    }
+
+    bool erase(safe_string key)
+    {
+        const char*         k  = key.c_str();
+        const hashed_length hl = hash_with_length(key);
+        shard&              s  = shard_for(hl.hash);
+
+        std::lock_guard<std::mutex> lock(s.mutex);
+        const std::size_t pos = find_slot(s, k, hl);
+        if (pos == s.slots.size())
+        {
+            return false;
+        }
+        remove(s, pos);
+        return true;
+    }
+
+    void clear()
+    {
+        for (std::size_t i = 0; i < shard_count_; ++i)
+        {
+            shard& s = shards_[i];
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.nodes.clear();
+            s.free_nodes.clear();
+            s.slots.clear();
+            s.count = 0;
+            s.bytes = 0;
+            s.hand  = 0;
+        }
+    }
+};
+
+} // namespace cinter
@@ -0,0 +1,641 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CINTER_CODEC_SSE2 1
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CINTER_CODEC_SSSE3 1
+#endif
+// The vector loops read whole blocks that may extend past the terminator
+// (never past the end of a page), which AddressSanitizer reports.
+#if defined(__SANITIZE_ADDRESS__)
+#undef CINTER_CODEC_SSE2
+#undef CINTER_CODEC_SSSE3
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#undef CINTER_CODEC_SSE2
+#undef CINTER_CODEC_SSSE3
+#endif
+#endif
+
+namespace cinter
+{
+
+/*
+Base64 (RFC 4648, standard and URL-safe alphabets) and hex codecs for
+C-strings.  Input is read straight from a safe_string: the terminator is
+found, and the input validated, in the same pass that converts it, so no
+strlen() precedes the work.  Output goes to a caller buffer, or is
+appended to a std::string.
+
+Every function returns a codec_result holding the number of characters
+or bytes written, or a negative codec_error value:
+
+    char out[64];
+    auto r = cinter::base64_encode(key, out, sizeof(out));
+    if (r.has_error()) { ... r.value() == cinter::codec_error::buffer_too_small ... }
+
+    unsigned char bytes[48];
+    auto d = cinter::base64_decode(token, bytes, sizeof(bytes), cinter::base64_alphabet::url);
+
+Encoders null terminate their output, so the buffer needs room for one
+more character than is returned.  Decoders write raw bytes with no
+terminator and accept input with or without '=' padding.
+
+With SSSE3 enabled at compile time (-mssse3, or any -march from
+x86-64-v2 up), base64 converts 12 bytes to 16 characters and back per
+step.  Hex uses SSE2, which every x86-64 target has.  Other targets use
+scalar loops.
+*/
+
+// Error values of codec_result.
+struct codec_error
+{
+    static constexpr std::ptrdiff_t invalid_character = -1;   // not in the alphabet, or misplaced padding
+    static constexpr std::ptrdiff_t invalid_length    = -2;   // input ends inside a unit
+    static constexpr std::ptrdiff_t buffer_too_small  = -3;
+};
+
+using codec_result = sentinel_result<std::ptrdiff_t, 0, greater_equal<std::ptrdiff_t>>;
+
+enum class base64_alphabet
+{
+    standard,   // A-Z a-z 0-9 + /
+    url         // A-Z a-z 0-9 - _
+};
+
+enum class hex_case
+{
+    lower,
+    upper
+};
+
+// Number of characters base64 encoding of size bytes produces, excluding
+// the terminator.
+[[nodiscard]] constexpr std::size_t base64_encoded_length(std::size_t size, bool pad = true) noexcept
+{
+    return pad ? (size + 2) / 3 * 4 : size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+}
+
+// Upper bound of the bytes decoded from length base64 characters.
+[[nodiscard]] constexpr std::size_t base64_decoded_length(std::size_t length) noexcept
+{
+    return length / 4 * 3 + length % 4 * 3 / 4;
+}
+
+[[nodiscard]] constexpr std::size_t hex_encoded_length(std::size_t size) noexcept
+{
+    return size * 2;
+}
+
+namespace detail
+{
+
+inline constexpr char base64_standard_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+inline constexpr char base64_url_chars[]      = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+struct base64_decode_table
+{
+    std::int8_t values[256];
+
+    constexpr explicit base64_decode_table(const char* chars) : values()
+    {
+        for (auto& v : values)
+        {
+            v = -1;
+        }
+        for (int i = 0; i < 64; ++i)
+        {
+            values[static_cast<unsigned char>(chars[i])] = static_cast<std::int8_t>(i);
+        }
+    }
+};
+
+inline constexpr base64_decode_table base64_standard_values(base64_standard_chars);
+inline constexpr base64_decode_table base64_url_values(base64_url_chars);
+
+[[nodiscard]] inline bool block_fits_page(const void* p, std::size_t size) noexcept
+{
+    return (reinterpret_cast<std::uintptr_t>(p) & 4095) <= 4096 - size;
+}
+
+#ifdef CINTER_CODEC_SSE2
+[[nodiscard]] inline unsigned zero_bytes(__m128i v) noexcept
+{
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())));
+}
+#endif
+
+// Encodes one group of three bytes, unless the terminator is among them.
+inline bool base64_encode_group(const unsigned char*& in, char*& out, const char* chars) noexcept
+{
+    if (in[0] == 0 || in[1] == 0 || in[2] == 0)
+    {
+        return false;
+    }
+    const std::uint32_t v = (std::uint32_t{in[0]} << 16) | (std::uint32_t{in[1]} << 8) | in[2];
+    out[0] = chars[v >> 18];
+    out[1] = chars[(v >> 12) & 63];
+    out[2] = chars[(v >> 6) & 63];
+    out[3] = chars[v & 63];
+    in += 3;
+    out += 4;
+    return true;
+}
+
+// Encodes whole groups of three bytes until fewer than three remain before
+// the terminator or fewer than four characters fit before out_end.
+inline void base64_encode_groups(const unsigned char*& in, char*& out, const char* out_end,
+                                 base64_alphabet alphabet) noexcept
+{
+    const char* chars = alphabet == base64_alphabet::url ? base64_url_chars : base64_standard_chars;
+#ifdef CINTER_CODEC_SSSE3
+    // Lemire and Mula, "Faster Base64 Encoding and Decoding using AVX2
+    // Instructions" (2018), on 128-bit vectors.
+    const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                                          static_cast<char>(chars[62] - 62), static_cast<char>(chars[63] - 63), 0, 0);
+    while (out_end - out >= 16)
+    {
+        if (!block_fits_page(in, 16))
+        {
+            // Cross the page boundary one group at a time.
+            if (!base64_encode_group(in, out, chars))
+            {
+                return;
+            }
+            continue;
+        }
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        if (zero_bytes(block) & 0x0fff)
+        {
+            break;
+        }
+        // Spread each group of three bytes over a 32-bit lane, then move
+        // each 6-bit field into its own byte.
+        const __m128i lanes = _mm_shuffle_epi8(block, shuffle);
+        const __m128i t0    = _mm_mulhi_epu16(_mm_and_si128(lanes, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        const __m128i t1    = _mm_mullo_epi16(_mm_and_si128(lanes, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        const __m128i index = _mm_or_si128(t0, t1);
+        // 0-25 -> 0, 26-51 -> 1, 52-61 -> 2-11, 62 -> 12, 63 -> 13.
+        __m128i range = _mm_subs_epu8(index, _mm_set1_epi8(51));
+        range         = _mm_sub_epi8(range, _mm_cmpgt_epi8(index, _mm_set1_epi8(25)));
+        const __m128i text = _mm_add_epi8(index, _mm_shuffle_epi8(offsets, range));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), text);
+        in += 12;
+        out += 16;
+    }
+#endif
+    while (out_end - out >= 4 && base64_encode_group(in, out, chars))
+    {
+    }
+}
+
+// Decodes one group of four characters, unless one of them is outside the
+// alphabet.  Each character is checked before the next is read, so nothing
+// past the terminator is touched.
+inline bool base64_decode_group(const unsigned char*& in, unsigned char*& out, const std::int8_t* values) noexcept
+{
+    const int a = values[in[0]];
+    if (a < 0)
+    {
+        return false;
+    }
+    const int b = values[in[1]];
+    if (b < 0)
+    {
+        return false;
+    }
+    const int c = values[in[2]];
+    if (c < 0)
+    {
+        return false;
+    }
+    const int d = values[in[3]];
+    if (d < 0)
+    {
+        return false;
+    }
+    const std::uint32_t v
+        = (std::uint32_t(a) << 18) | (std::uint32_t(b) << 12) | (std::uint32_t(c) << 6) | std::uint32_t(d);
+    out[0] = static_cast<unsigned char>(v >> 16);
+    out[1] = static_cast<unsigned char>(v >> 8);
+    out[2] = static_cast<unsigned char>(v);
+    in += 4;
+    out += 3;
+    return true;
+}
+
+// Decodes whole groups of four characters until a group holds a character
+// outside the alphabet (including the terminator and padding) or fewer
+// than three bytes fit before out_end.
+inline void base64_decode_groups(const unsigned char*& in, unsigned char*& out, const unsigned char* out_end,
+                                 base64_alphabet alphabet) noexcept
+{
+    const std::int8_t* values
+        = alphabet == base64_alphabet::url ? base64_url_values.values : base64_standard_values.values;
+#ifdef CINTER_CODEC_SSSE3
+    // Each character is classified by its high and low nibble: lo_bits[lo]
+    // & hi_bits[hi] is nonzero exactly for characters outside the alphabet.
+    const bool    url     = alphabet == base64_alphabet::url;
+    const __m128i lo_bits = url ? _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3b,
+                                                0x3b, 0x3a, 0x3b, 0x33)
+                                : _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+                                                0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i hi_bits = url ? _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x10, 0x10)
+                                : _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x10, 0x10);
+    // Offset from character to value by high nibble; index 1 is '/'.
+    const __m128i roll = url ? _mm_setr_epi8(0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0)
+                             : _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i pack   = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    while (out_end - out >= 16)
+    {
+        if (!block_fits_page(in, 16))
+        {
+            if (!base64_decode_group(in, out, values))
+            {
+                return;
+            }
+            continue;
+        }
+        __m128i       text = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        const __m128i hi   = _mm_and_si128(_mm_srli_epi32(text, 4), nibble);
+        const __m128i lo   = _mm_and_si128(text, nibble);
+        const __m128i bad  = _mm_and_si128(_mm_shuffle_epi8(lo_bits, lo), _mm_shuffle_epi8(hi_bits, hi));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(bad, _mm_setzero_si128())) != 0xffff)
+        {
+            break;
+        }
+        __m128i offset;
+        if (url)
+        {
+            // '_' shares its high nibble with 'P'-'Z'.
+            const __m128i underscore = _mm_cmpeq_epi8(text, _mm_set1_epi8('_'));
+            offset = _mm_or_si128(_mm_andnot_si128(underscore, _mm_shuffle_epi8(roll, hi)),
+                                  _mm_and_si128(underscore, _mm_set1_epi8(63 - '_')));
+        }
+        else
+        {
+            offset = _mm_shuffle_epi8(roll, _mm_add_epi8(_mm_cmpeq_epi8(text, _mm_set1_epi8('/')), hi));
+        }
+        text = _mm_add_epi8(text, offset);
+        // Merge four 6-bit values per lane into 24 bits, then gather the
+        // three bytes of each lane in order.
+        const __m128i pairs = _mm_maddubs_epi16(text, _mm_set1_epi32(0x01400140));
+        const __m128i lanes = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(lanes, pack));
+        in += 16;
+        out += 12;
+    }
+#endif
+    while (out_end - out >= 3 && base64_decode_group(in, out, values))
+    {
+    }
+}
+
+[[nodiscard]] inline int hex_value(unsigned char c) noexcept
+{
+    if (static_cast<unsigned>(c - '0') < 10)
+    {
+        return c - '0';
+    }
+    if (static_cast<unsigned>((c | 0x20) - 'a') < 6)
+    {
+        return (c | 0x20) - 'a' + 10;
+    }
+    return -1;
+}
+
+} // namespace detail
+
+// Encodes the characters of in, up to its terminator, into out[0 ..
+// capacity).  With pad false the trailing '=' characters are omitted, as
+// is usual for the URL alphabet.
+inline codec_result base64_encode(safe_string in, char* out, std::size_t capacity,
+                                  base64_alphabet alphabet = base64_alphabet::standard, bool pad = true) noexcept
+{
+    if (capacity == 0)
+    {
+        return codec_error::buffer_too_small;
+    }
+    const auto* p   = reinterpret_cast<const unsigned char*>(in.c_str());
+    char*       o   = out;
+    char* const end = out + capacity - 1;   // room for the terminator
+    detail::base64_encode_groups(p, o, end, alphabet);
+    if (p[0] != 0)
+    {
+        const char* chars = alphabet == base64_alphabet::url ? detail::base64_url_chars : detail::base64_standard_chars;
+        if (p[1] != 0 && p[2] != 0)
+        {
+            return codec_error::buffer_too_small;
+        }
+        const std::size_t   rest = p[1] != 0 ? 2 : 1;
+        const std::uint32_t v    = (std::uint32_t{p[0]} << 16) | (rest == 2 ? std::uint32_t{p[1]} << 8 : 0);
+        if (static_cast<std::size_t>(end - o) < (pad ? 4 : rest + 1))
+        {
+            return codec_error::buffer_too_small;
+        }
+        *o++ = chars[v >> 18];
+        *o++ = chars[(v >> 12) & 63];
+        if (rest == 2)
+        {
+            *o++ = chars[(v >> 6) & 63];
+        }
+        else if (pad)
+        {
+            *o++ = '=';
+        }
+        if (pad)
+        {
+            *o++ = '=';
+        }
+    }
+    *o = '\0';
+    return o - out;
+}
+
+// Decodes in into out[0 .. capacity).  Padding is optional, but if present
+// must complete the last group of four.
+inline codec_result base64_decode(safe_string in, void* out, std::size_t capacity,
+                                  base64_alphabet alphabet = base64_alphabet::standard) noexcept
+{
+    const auto*          p     = reinterpret_cast<const unsigned char*>(in.c_str());
+    auto* const          first = static_cast<unsigned char*>(out);
+    unsigned char*       o     = first;
+    const unsigned char* end   = first + capacity;
+    detail::base64_decode_groups(p, o, end, alphabet);
+
+    // At most one partial group remains, possibly padded.
+    const std::int8_t* values
+        = alphabet == base64_alphabet::url ? detail::base64_url_values.values : detail::base64_standard_values.values;
+    std::uint32_t v     = 0;
+    std::size_t   count = 0;
+    for (;; ++p)
+    {
+        const int value = values[*p];
+        if (value < 0)
+        {
+            break;
+        }
+        if (count == 4)
+        {
+            // A full group stopped the loop above: the output is full.
+            return codec_error::buffer_too_small;
+        }
+        v = (v << 6) | static_cast<std::uint32_t>(value);
+        ++count;
+    }
+    if (count == 4)
+    {
+        if (*p != 0)
+        {
+            return codec_error::invalid_character;
+        }
+        return codec_error::buffer_too_small;
+    }
+    if (*p == '=')
+    {
+        if (count == 1)
+        {
+            return codec_error::invalid_length;
+        }
+        if (count == 0 || (count == 2 && p[1] != '=') || p[count == 2 ? 2 : 1] != 0)
+        {
+            return codec_error::invalid_character;
+        }
+    }
+    else if (*p != 0)
+    {
+        return codec_error::invalid_character;
+    }
+    if (count == 1)
+    {
+        return codec_error::invalid_length;
+    }
+    if (count != 0)
+    {
+        const std::size_t bytes = count - 1;
+        if (static_cast<std::size_t>(end - o) < bytes)
+        {
+            return codec_error::buffer_too_small;
+        }
+        v <<= 6 * (4 - count);
+        *o++ = static_cast<unsigned char>(v >> 16);
+        if (bytes == 2)
+        {
+            *o++ = static_cast<unsigned char>(v >> 8);
+        }
+    }
+    return o - first;
+}
+
+// Encodes each character of in as two hex digits.
+inline codec_result hex_encode(safe_string in, char* out, std::size_t capacity, hex_case letters = hex_case::lower) noexcept
+{
+    if (capacity == 0)
+    {
+        return codec_error::buffer_too_small;
+    }
+    const auto* p     = reinterpret_cast<const unsigned char*>(in.c_str());
+    char*       o     = out;
+    char* const end   = out + capacity - 1;
+    const char* chars = letters == hex_case::upper ? "0123456789ABCDEF" : "0123456789abcdef";
+#ifdef CINTER_CODEC_SSE2
+    const __m128i nibble  = _mm_set1_epi8(0x0f);
+    const __m128i nine    = _mm_set1_epi8(9);
+    const __m128i letter  = _mm_set1_epi8(static_cast<char>(chars[10] - '0' - 10));
+    auto          to_text = [&](__m128i n) {
+        return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(n, nine), letter));
+    };
+    while (end - o >= 32 && *p != 0)
+    {
+        if (!detail::block_fits_page(p, 16))
+        {
+            *o++ = chars[*p >> 4];
+            *o++ = chars[*p++ & 15];
+            continue;
+        }
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        if (detail::zero_bytes(block))
+        {
+            break;
+        }
+        const __m128i hi = to_text(_mm_and_si128(_mm_srli_epi16(block, 4), nibble));
+        const __m128i lo = to_text(_mm_and_si128(block, nibble));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 16), _mm_unpackhi_epi8(hi, lo));
+        p += 16;
+        o += 32;
+    }
+#endif
+    for (; *p != 0; ++p)
+    {
+        if (end - o < 2)
+        {
+            return codec_error::buffer_too_small;
+        }
+        *o++ = chars[*p >> 4];
+        *o++ = chars[*p & 15];
+    }
+    *o = '\0';
+    return o - out;
+}
+
+// Decodes pairs of hex digits, in either case.
+inline codec_result hex_decode(safe_string in, void* out, std::size_t capacity) noexcept
+{
+    const auto*          p     = reinterpret_cast<const unsigned char*>(in.c_str());
+    auto* const          first = static_cast<unsigned char*>(out);
+    unsigned char*       o     = first;
+    const unsigned char* end   = first + capacity;
+#ifdef CINTER_CODEC_SSE2
+    // Digits and letters are mapped with unsigned range checks; any other
+    // character, including the terminator, ends the vector loop.
+    const __m128i digit_base  = _mm_set1_epi8('0');
+    const __m128i letter_base = _mm_set1_epi8('a');
+    const __m128i case_bit    = _mm_set1_epi8(0x20);
+    auto          to_values   = [&](__m128i text, __m128i& values) {
+        const __m128i d        = _mm_sub_epi8(text, digit_base);
+        const __m128i l        = _mm_sub_epi8(_mm_or_si128(text, case_bit), letter_base);
+        const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+        const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+        values = _mm_or_si128(_mm_and_si128(is_digit, d),
+                              _mm_and_si128(is_alpha, _mm_add_epi8(l, _mm_set1_epi8(10))));
+        return _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) == 0xffff;
+    };
+    // Joins the nibble pairs of a block into eight bytes, one per 16-bit lane.
+    auto join = [](__m128i values) {
+        return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00ff)), 4),
+                            _mm_srli_epi16(values, 8));
+    };
+    while (end - o >= 16)
+    {
+        if (!detail::block_fits_page(p, 32))
+        {
+            const int hi = detail::hex_value(p[0]);
+            const int lo = hi < 0 ? -1 : detail::hex_value(p[1]);
+            if (lo < 0)
+            {
+                break;
+            }
+            *o++ = static_cast<unsigned char>(hi << 4 | lo);
+            p += 2;
+            continue;
+        }
+        __m128i a;
+        __m128i b;
+        if (!to_values(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), a)
+            || !to_values(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), b))
+        {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_packus_epi16(join(a), join(b)));
+        p += 32;
+        o += 16;
+    }
+#endif
+    for (; *p != 0; p += 2)
+    {
+        const int hi = detail::hex_value(p[0]);
+        if (hi < 0)
+        {
+            return codec_error::invalid_character;
+        }
+        if (p[1] == 0)
+        {
+            return codec_error::invalid_length;
+        }
+        const int lo = detail::hex_value(p[1]);
+        if (lo < 0)
+        {
+            return codec_error::invalid_character;
+        }
+        if (o == end)
+        {
+            return codec_error::buffer_too_small;
+        }
+        *o++ = static_cast<unsigned char>(hi << 4 | lo);
+    }
+    return o - first;
+}
+
+// The std::string overloads append to out.  They measure the input first
+// so that out grows once.
+inline codec_result base64_encode(safe_string in, std::string& out,
+                                  base64_alphabet alphabet = base64_alphabet::standard, bool pad = true)
+{
+    const std::size_t old = out.size();
+    out.resize(old + base64_encoded_length(std::char_traits<char>::length(in.c_str()), pad) + 1);
+    const codec_result r = base64_encode(in, &out[old], out.size() - old, alphabet, pad);
+    out.resize(r.is_ok() ? old + static_cast<std::size_t>(r.value()) : old);
+    return r;
+}
+
+inline codec_result base64_decode(safe_string in, std::string& out, base64_alphabet alphabet = base64_alphabet::standard)
+{
+    const std::size_t old = out.size();
+    out.resize(old + base64_decoded_length(std::char_traits<char>::length(in.c_str())));
+    const codec_result r = base64_decode(in, &out[old], out.size() - old, alphabet);
+    out.resize(r.is_ok() ? old + static_cast<std::size_t>(r.value()) : old);
+    return r;
+}
+
+inline codec_result hex_encode(safe_string in, std::string& out, hex_case letters = hex_case::lower)
+{
+    const std::size_t old = out.size();
+    out.resize(old + hex_encoded_length(std::char_traits<char>::length(in.c_str())) + 1);
+    const codec_result r = hex_encode(in, &out[old], out.size() - old, letters);
+    out.resize(r.is_ok() ? old + static_cast<std::size_t>(r.value()) : old);
+    return r;
+}
+
+inline codec_result hex_decode(safe_string in, std::string& out)
+{
+    const std::size_t old = out.size();
+    out.resize(old + std::char_traits<char>::length(in.c_str()) / 2);
+    const codec_result r = hex_decode(in, &out[old], out.size() - old);
+    out.resize(r.is_ok() ? old + static_cast<std::size_t>(r.value()) : old);
+    return r;
+}
+
+} // namespace cinter
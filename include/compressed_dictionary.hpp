@@ -0,0 +1,424 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+
+namespace cinter
+{
+
+/*
+compressed_dictionary is a read-only collection of C-strings compressed
+with a static symbol table in the style of FSST (Fast Static Symbol Table,
+Boncz, Neumann and Leis, VLDB 2020).  Up to 255 symbols of one to eight
+bytes are learned from a sample of the input; each string is then stored as
+a sequence of one-byte codes, with code 255 escaping a literal byte.
+Because every string is compressed on its own, any entry can be
+decompressed without touching its neighbours.
+
+Redundant data such as paths, URLs and symbol names typically compresses
+to a third or half of its size.
+
+    cinter::compressed_dictionary dict(paths.data(), paths.size());
+    char buffer[PATH_MAX];
+    dict.extract(id, buffer, sizeof(buffer));
+    if (dict.equals(id, candidate)) { ... }
+
+equals() compresses the key on the fly and compares codes, so it never
+materializes either string.  starts_with() decodes the entry incrementally
+and stops at the first mismatch.
+*/
+class compressed_dictionary
+{
+public:
+    using id_type = std::uint32_t;
+
+private:
+    static constexpr unsigned    escape_code = 255;
+    static constexpr unsigned    max_symbols = 255;
+    static constexpr std::size_t max_sample  = 256 * 1024;
+    static constexpr int         generations = 5;
+
+    struct symbol
+    {
+        std::uint64_t bytes  = 0;  // in memory order, zero padded
+        std::uint8_t  length = 0;
+
+        [[nodiscard]] bool operator==(const symbol& other) const noexcept
+        {
+            return bytes == other.bytes && length == other.length;
+        }
+    };
+
+    struct symbol_hash
+    {
+        [[nodiscard]] std::size_t operator()(const symbol& s) const noexcept
+        {
+            return static_cast<std::size_t>((s.bytes ^ s.length) * 0x9e3779b97f4a7c15ull >> 7);
+        }
+    };
+
+    std::uint64_t symbols_[max_symbols] = {};
+    std::uint8_t  lengths_[max_symbols] = {};
+    unsigned      symbol_count_         = 0;
+    // Codes sorted by first byte, longest first; codes for byte b are
+    // by_first_[first_[b] .. first_[b + 1]).
+    std::uint16_t              first_[257]            = {};
+    std::uint8_t               by_first_[max_symbols] = {};
+    std::vector<unsigned char> codes_;
+    std::vector<std::uint32_t> offsets_{0};
+    std::size_t                raw_bytes_ = 0;
+
+    [[nodiscard]] static symbol make_symbol(const unsigned char* p, std::size_t length) noexcept
+    {
+        symbol s;
+        s.length = static_cast<std::uint8_t>(length);
+        std::memcpy(&s.bytes, p, length);
+        return s;
+    }
+
+    [[nodiscard]] static symbol concat(const symbol& a, const symbol& b) noexcept
+    {
+        unsigned char buf[16];
+        std::memcpy(buf, &a.bytes, 8);
+        std::memcpy(buf + a.length, &b.bytes, 8);
+        return make_symbol(buf, std::min<std::size_t>(8, std::size_t{a.length} + b.length));
+    }
+
+    // Longest symbol matching the C-string at p, or -1.  Symbols never
+    // contain a null character, so the comparison stops at the terminator
+    // without needing the length of the string.
+    [[nodiscard]] int match(const unsigned char* p) const noexcept
+    {
+        for (unsigned k = first_[p[0]]; k < first_[p[0] + 1u]; ++k)
+        {
+            const unsigned       code = by_first_[k];
+            const unsigned char* sym  = reinterpret_cast<const unsigned char*>(&symbols_[code]);
+            unsigned             i    = 1;
+            while (i < lengths_[code] && p[i] == sym[i])
+            {
+                ++i;
+            }
+            if (i == lengths_[code])
+            {
+                return static_cast<int>(code);
+            }
+        }
+        return -1;
+    }
+
+    [[nodiscard]] unsigned char first_byte(unsigned code) const noexcept
+    {
+        return reinterpret_cast<const unsigned char*>(&symbols_[code])[0];
+    }
+
+    // Decodes the code at p, advancing p past it (and its literal).
+    [[nodiscard]] const unsigned char* decode(const unsigned char*& p, unsigned& length) const noexcept
+    {
+        if (*p == escape_code)
+        {
+            length = 1;
+            p += 2;
+            return p - 1;
+        }
+        length = lengths_[*p];
+        return reinterpret_cast<const unsigned char*>(&symbols_[*p++]);
+    }
+
+    void index_symbols() noexcept
+    {
+        unsigned order[max_symbols];
+        for (unsigned i = 0; i < symbol_count_; ++i)
+        {
+            order[i] = i;
+        }
+        std::sort(order, order + symbol_count_, [this](unsigned a, unsigned b) {
+            const unsigned char fa = first_byte(a);
+            const unsigned char fb = first_byte(b);
+            return fa != fb ? fa < fb : lengths_[a] > lengths_[b];
+        });
+        std::fill(std::begin(first_), std::end(first_), std::uint16_t{0});
+        for (unsigned i = 0; i < symbol_count_; ++i)
+        {
+            by_first_[i] = static_cast<std::uint8_t>(order[i]);
+            ++first_[first_byte(order[i]) + 1u];
+        }
+        for (unsigned b = 0; b < 256; ++b)
+        {
+            first_[b + 1] = static_cast<std::uint16_t>(first_[b + 1] + first_[b]);
+        }
+    }
+
+    // One FSST generation: parse the sample with the current table, count
+    // how often each symbol and each pair of adjacent symbols occurs, and
+    // keep the 255 candidates that save the most bytes.
+    void learn(const std::vector<const unsigned char*>& sample)
+    {
+        std::unordered_map<symbol, std::size_t, symbol_hash> counts;
+        for (const unsigned char* s : sample)
+        {
+            symbol prev;
+            for (const unsigned char* p = s; *p;)
+            {
+                const int    code = match(p);
+                const symbol cur  = code < 0 ? make_symbol(p, 1) : symbol{symbols_[code], lengths_[code]};
+                ++counts[cur];
+                if (prev.length)
+                {
+                    ++counts[concat(prev, cur)];
+                }
+                prev = cur;
+                p += cur.length;
+            }
+        }
+        std::vector<std::pair<std::size_t, symbol>> ranked;
+        ranked.reserve(counts.size());
+        for (const auto& c : counts)
+        {
+            ranked.emplace_back(c.second * c.first.length, c.first);
+        }
+        const std::size_t keep = std::min<std::size_t>(max_symbols, ranked.size());
+        std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(), [](const auto& a, const auto& b) {
+            if (a.first != b.first)
+            {
+                return a.first > b.first;
+            }
+            return a.second.length != b.second.length ? a.second.length > b.second.length
+                                                      : a.second.bytes < b.second.bytes;
+        });
+        symbol_count_ = static_cast<unsigned>(keep);
+        for (unsigned i = 0; i < symbol_count_; ++i)
+        {
+            symbols_[i] = ranked[i].second.bytes;
+            lengths_[i] = ranked[i].second.length;
+        }
+        index_symbols();
+    }
+
+    void compress(const unsigned char* p)
+    {
+        while (*p)
+        {
+            const int code = match(p);
+            if (code < 0)
+            {
+                codes_.push_back(static_cast<unsigned char>(escape_code));
+                codes_.push_back(*p++);
+            }
+            else
+            {
+                codes_.push_back(static_cast<unsigned char>(code));
+                p += lengths_[code];
+            }
+        }
+    }
+
+public:
+    compressed_dictionary() = default;
+
+    // Learns a symbol table from (a sample of) strings and compresses all of
+    // them.  Null strings are stored as empty strings.  Entry ids are the
+    // indices into strings.
+    compressed_dictionary(const safe_string* strings, std::size_t count)
+    {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            total += std::strlen(strings[i].c_str());
+        }
+        raw_bytes_ = total;
+
+        std::vector<const unsigned char*> sample;
+        const std::size_t                 stride = total > max_sample ? total / max_sample + 1 : 1;
+        for (std::size_t i = 0; i < count; i += stride)
+        {
+            sample.push_back(reinterpret_cast<const unsigned char*>(strings[i].c_str()));
+        }
+        for (int g = 0; g < generations; ++g)
+        {
+            learn(sample);
+        }
+
+        offsets_.reserve(count + 1);
+        codes_.reserve(total / 2);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            compress(reinterpret_cast<const unsigned char*>(strings[i].c_str()));
+            offsets_.push_back(static_cast<std::uint32_t>(codes_.size()));
+        }
+        codes_.shrink_to_fit();
+    }
+
+#ifdef __cpp_lib_span
+    explicit compressed_dictionary(std::span<const safe_string> strings)
+        : compressed_dictionary(strings.data(), strings.size())
+    {}
+#endif
+
+    [[nodiscard]] std::size_t size() const noexcept { return offsets_.size() - 1; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    // Total length of the original strings, without terminators.
+    [[nodiscard]] std::size_t raw_bytes() const noexcept { return raw_bytes_; }
+
+    // Memory held by the dictionary, symbol table and offsets included.
+    [[nodiscard]] std::size_t memory_usage() const noexcept
+    {
+        return sizeof(*this) + codes_.capacity() + offsets_.capacity() * sizeof(std::uint32_t);
+    }
+
+    // Decompresses entry id into out and null terminates it, truncating if
+    // capacity is too small.  Like snprintf, returns the full length of the
+    // entry, so a result >= capacity means the output was truncated.
+    std::size_t extract(id_type id, char* out, std::size_t capacity) const noexcept
+    {
+        const unsigned char* p   = codes_.data() + offsets_[id];
+        const unsigned char* end = codes_.data() + offsets_[id + 1];
+        std::size_t          n   = 0;
+        // Fast path: copy whole 8-byte symbols while they fit.
+        while (p < end && n + 8 < capacity)
+        {
+            if (*p == escape_code)
+            {
+                out[n++] = static_cast<char>(p[1]);
+                p += 2;
+            }
+            else
+            {
+                std::memcpy(out + n, &symbols_[*p], 8);
+                n += lengths_[*p];
+                ++p;
+            }
+        }
+        while (p < end)
+        {
+            unsigned                   length;
+            const unsigned char* const sym = decode(p, length);
+            for (unsigned i = 0; i < length; ++i, ++n)
+            {
+                if (n + 1 < capacity)
+                {
+                    out[n] = static_cast<char>(sym[i]);
+                }
+            }
+        }
+        if (capacity)
+        {
+            out[n < capacity ? n : capacity - 1] = '\0';
+        }
+        return n;
+    }
+
+    [[nodiscard]] std::string string(id_type id) const
+    {
+        std::string s(64, '\0');
+        std::size_t n = extract(id, s.data(), s.size() + 1);
+        if (n > s.size())
+        {
+            s.assign(n, '\0');
+            n = extract(id, s.data(), n + 1);
+        }
+        s.resize(n);
+        return s;
+    }
+
+    // Compares entry id with key by compressing key on the fly; compression
+    // is deterministic, so equal strings have equal codes.
+    [[nodiscard]] bool equals(id_type id, safe_string key) const noexcept
+    {
+        const unsigned char* p   = codes_.data() + offsets_[id];
+        const unsigned char* end = codes_.data() + offsets_[id + 1];
+        const unsigned char* k   = reinterpret_cast<const unsigned char*>(key.c_str());
+        while (*k)
+        {
+            const int code = match(k);
+            if (code < 0)
+            {
+                if (end - p < 2 || p[0] != escape_code || p[1] != *k)
+                {
+                    return false;
+                }
+                p += 2;
+                ++k;
+            }
+            else
+            {
+                if (p == end || *p != code)
+                {
+                    return false;
+                }
+                ++p;
+                k += lengths_[code];
+            }
+        }
+        return p == end;
+    }
+
+    // True if entry id starts with prefix.  Decodes the entry one symbol at
+    // a time and stops at the first mismatch.
+    [[nodiscard]] bool starts_with(id_type id, safe_string prefix) const noexcept
+    {
+        const unsigned char* p   = codes_.data() + offsets_[id];
+        const unsigned char* end = codes_.data() + offsets_[id + 1];
+        const unsigned char* k   = reinterpret_cast<const unsigned char*>(prefix.c_str());
+        while (*k)
+        {
+            if (p == end)
+            {
+                return false;
+            }
+            unsigned                   length;
+            const unsigned char* const sym = decode(p, length);
+            for (unsigned i = 0; i < length && *k; ++i, ++k)
+            {
+                if (sym[i] != *k)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace cinter
@@ -0,0 +1,357 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "hash.hpp"
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cinter
+{
+
+/*
+concurrent_string_map maps C-strings to values for many threads at once.
+It is split into shards, each an open-addressing table with its own writer
+mutex; the top bits of a key's hash pick the shard and the low bits the
+slot.  The key is hashed in the same pass that finds its terminator, once
+per operation.
+
+Lookups take no locks.  Entries are immutable once published and tables
+are replaced rather than resized in place: a writer fills a new, larger
+table, publishes it with a release store and keeps the old one until the
+map is destroyed (the same retire-until-destruction scheme radix_tree
+uses), so a reader that is still probing an old table never touches freed
+memory.  A key present before a lookup starts is always found.
+
+Keys are copied into a per-shard arena only when they are inserted, next
+to their entry, and an entry stays at the same address for the lifetime of
+the map.  There is no erase.  The map never touches a value after
+constructing it; values that threads update concurrently must be safe for
+that themselves, e.g. std::atomic counters:
+
+    cinter::concurrent_string_map<std::atomic<std::uint64_t>> counts;
+    // On any number of threads:
+    counts.try_emplace(id).first->value.fetch_add(1, std::memory_order_relaxed);
+
+When an existing key is looked up, try_emplace() also takes no lock, so
+counting into known keys never blocks.
+*/
+template <typename Value>
+class concurrent_string_map
+{
+public:
+    struct entry
+    {
+        safe_string   key;
+        std::size_t   length;
+        std::uint64_t hash;
+        Value         value;
+    };
+
+    using find_result = sentinel_result<entry*, nullptr, not_equal_to<entry*>>;
+
+private:
+    struct table
+    {
+        std::size_t                             mask;
+        std::unique_ptr<std::atomic<entry*>[]>  slots;
+
+        explicit table(std::size_t slot_count)
+            : mask(slot_count - 1)
+            , slots(new std::atomic<entry*>[slot_count])
+        {
+            for (std::size_t i = 0; i < slot_count; ++i)
+            {
+                slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    struct chunk
+    {
+        void*       data;
+        std::size_t size;
+    };
+
+    // Shards are padded to separate cache lines so that writers to one do
+    // not slow down readers of its neighbours.
+    struct alignas(64) shard
+    {
+        std::atomic<table*>                 current{nullptr};
+        std::atomic<std::size_t>            count{0};
+        std::mutex                          mutex;
+        std::vector<std::unique_ptr<table>> tables;
+        std::vector<chunk>                  chunks;
+        std::size_t                         chunk_used = 0;
+    };
+
+    static constexpr std::size_t chunk_bytes = 64 * 1024;
+    static constexpr std::size_t min_slots   = 16;
+    static constexpr std::size_t key_offset  = sizeof(entry);
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t              shard_count_;
+    unsigned                 shard_shift_;
+
+    [[nodiscard]] static std::size_t default_shard_count() noexcept
+    {
+        const std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        std::size_t n = 16;
+        while (n < threads * 4)
+        {
+            n *= 2;
+        }
+        return n;
+    }
+
+    [[nodiscard]] shard& shard_for(std::uint64_t hash) const noexcept
+    {
+        return shards_[shard_shift_ == 64 ? 0 : static_cast<std::size_t>(hash >> shard_shift_)];
+    }
+
+    [[nodiscard]] static entry* probe(const table* t, const char* key, const hashed_length& hl) noexcept
+    {
+        for (std::size_t i = hl.hash & t->mask;; i = (i + 1) & t->mask)
+        {
+            entry* e = t->slots[i].load(std::memory_order_acquire);
+            if (!e)
+            {
+                return nullptr;
+            }
+            if (e->hash == hl.hash && e->length == hl.length && std::memcmp(e->key.c_str(), key, hl.length) == 0)
+            {
+                return e;
+            }
+        }
+    }
+
+    static void place(table& t, entry* e) noexcept
+    {
+        std::size_t i = e->hash & t.mask;
+        while (t.slots[i].load(std::memory_order_relaxed))
+        {
+            i = (i + 1) & t.mask;
+        }
+        t.slots[i].store(e, std::memory_order_release);
+    }
+
+    // Called with s.mutex held.  The new table is complete before it is
+    // published, so readers see either the old table or the full new one.
+    static table& grow(shard& s, std::size_t slot_count)
+    {
+        auto bigger = std::make_unique<table>(slot_count);
+        if (const table* old = s.current.load(std::memory_order_relaxed))
+        {
+            for (std::size_t i = 0; i <= old->mask; ++i)
+            {
+                if (entry* e = old->slots[i].load(std::memory_order_relaxed))
+                {
+                    place(*bigger, e);
+                }
+            }
+        }
+        s.tables.reserve(s.tables.size() + 1);
+        table* published = bigger.get();
+        s.tables.push_back(std::move(bigger));
+        s.current.store(published, std::memory_order_release);
+        return *published;
+    }
+
+    // Called with s.mutex held.  Returns storage for an entry followed by
+    // length + 1 key characters.
+    [[nodiscard]] static void* allocate(shard& s, std::size_t length)
+    {
+        constexpr std::size_t align = alignof(entry);
+        const std::size_t needed = key_offset + length + 1;
+        std::size_t offset = (s.chunk_used + align - 1) / align * align;
+        if (s.chunks.empty() || offset + needed > s.chunks.back().size)
+        {
+            const std::size_t size = std::max(chunk_bytes, needed);
+            s.chunks.reserve(s.chunks.size() + 1);
+            s.chunks.push_back(chunk{::operator new(size, std::align_val_t(align)), size});
+            offset = 0;
+        }
+        s.chunk_used = offset + needed;
+        return static_cast<unsigned char*>(s.chunks.back().data) + offset;
+    }
+
+    void release() noexcept
+    {
+        for (std::size_t i = 0; i < shard_count_; ++i)
+        {
+            shard& s = shards_[i];
+            if (const table* t = s.current.load(std::memory_order_relaxed))
+            {
+                for (std::size_t j = 0; j <= t->mask; ++j)
+                {
+                    if (entry* e = t->slots[j].load(std::memory_order_relaxed))
+                    {
+                        e->~entry();
+                    }
+                }
+            }
+            for (const chunk& c : s.chunks)
+            {
+                ::operator delete(c.data, std::align_val_t(alignof(entry)));
+            }
+        }
+    }
+
+public:
+    // shard_count is rounded up to a power of two.  By default there are
+    // four shards per hardware thread, and at least 16.
+    explicit concurrent_string_map(std::size_t shard_count = 0)
+    {
+        std::size_t n = 1;
+        unsigned bits = 0;
+        const std::size_t wanted = shard_count ? shard_count : default_shard_count();
+        while (n < wanted)
+        {
+            n *= 2;
+            ++bits;
+        }
+        shards_.reset(new shard[n]);
+        shard_count_ = n;
+        shard_shift_ = 64 - bits;
+    }
+
+    concurrent_string_map(const concurrent_string_map& other) = delete;
+    concurrent_string_map& operator=(const concurrent_string_map& other) = delete;
+
+    ~concurrent_string_map() noexcept
+    {
+        release();
+    }
+
+    [[nodiscard]] std::size_t shard_count() const noexcept { return shard_count_; }
+
+    // Number of entries.  Exact when no insert is in progress.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < shard_count_; ++i)
+        {
+            n += shards_[i].count.load(std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] find_result find(safe_string key) const noexcept
+    {
+        const hashed_length hl = hash_with_length(key);
+        const table* t = shard_for(hl.hash).current.load(std::memory_order_acquire);
+        return t ? probe(t, key.c_str(), hl) : nullptr;
+    }
+
+    [[nodiscard]] bool contains(safe_string key) const noexcept
+    {
+        return find(key).is_ok();
+    }
+
+    // Returns the entry for key and whether it was inserted.  A new entry's
+    // value is constructed from args; if key is present the args are
+    // ignored.  A null key is the empty string.
+    template <typename... Args>
+    std::pair<entry*, bool> try_emplace(safe_string key, Args&&... args)
+    {
+        const char*         k  = key.c_str();
+        const hashed_length hl = hash_with_length(key);
+        shard&              s  = shard_for(hl.hash);
+        if (const table* t = s.current.load(std::memory_order_acquire))
+        {
+            if (entry* e = probe(t, k, hl))
+            {
+                return {e, false};
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(s.mutex);
+        table* t = s.current.load(std::memory_order_relaxed);
+        if (t)
+        {
+            // Another writer may have inserted key since the first probe.
+            if (entry* e = probe(t, k, hl))
+            {
+                return {e, false};
+            }
+        }
+        const std::size_t count = s.count.load(std::memory_order_relaxed);
+        if (!t || (count + 1) * 2 > t->mask + 1)
+        {
+            t = &grow(s, t ? (t->mask + 1) * 2 : min_slots);
+        }
+
+        void* storage = allocate(s, hl.length);
+        char* copy = static_cast<char*>(storage) + key_offset;
+        std::memcpy(copy, k, hl.length);
+        copy[hl.length] = '\0';
+        entry* e = ::new (storage) entry{copy, hl.length, hl.hash, Value(std::forward<Args>(args)...)};
+        place(*t, e);
+        s.count.store(count + 1, std::memory_order_relaxed);
+        return {e, true};
+    }
+
+    // Calls fn(entry&) for every entry, without locks.  Entries inserted
+    // while the walk is in progress may or may not be visited.
+    template <typename Fn>
+    void for_each(Fn&& fn) const
+    {
+        for (std::size_t i = 0; i < shard_count_; ++i)
+        {
+            const table* t = shards_[i].current.load(std::memory_order_acquire);
+            if (!t)
+            {
+                continue;
+            }
+            for (std::size_t j = 0; j <= t->mask; ++j)
+            {
+                if (entry* e = t->slots[j].load(std::memory_order_acquire))
+                {
+                    fn(*e);
+                }
+            }
+        }
+    }
+};
+
+} // namespace cinter
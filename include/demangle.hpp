@@ -0,0 +1,196 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include "string_table.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+// Demangling of Itanium C++ ABI symbol names (GCC, Clang) through
+// abi::__cxa_demangle.  This header is not usable with MSVC.
+
+namespace cinter
+{
+
+// Status values of abi::__cxa_demangle.
+struct demangle_error
+{
+    static constexpr int memory_failure   = -1;
+    static constexpr int invalid_name     = -2;   // not a mangled name, e.g. a C symbol
+    static constexpr int invalid_argument = -3;
+};
+
+using demangle_status = sentinel_result<int, 0>;
+
+struct demangle_result
+{
+    demangle_status status;
+    // The demangled name, or the input name if status has_error().
+    safe_string     name;
+};
+
+namespace detail
+{
+
+// The output buffer abi::__cxa_demangle writes into.  It must come from
+// malloc: __cxa_demangle replaces it with a larger one when a name does not
+// fit.
+struct demangle_buffer
+{
+    char*       data     = nullptr;
+    std::size_t capacity = 0;
+
+    demangle_buffer() noexcept = default;
+    demangle_buffer(const demangle_buffer& other) = delete;
+    demangle_buffer& operator=(const demangle_buffer& other) = delete;
+
+    ~demangle_buffer() noexcept
+    {
+        std::free(data);
+    }
+};
+
+inline thread_local demangle_buffer thread_demangle_buffer;
+
+} // namespace detail
+
+// Demangles mangled into a buffer owned by the calling thread that grows to
+// fit the longest name seen so far, instead of a fresh malloc'ed string per
+// call.  The name is valid until the next call to demangle() on the same
+// thread; copy it, or use demangler, to keep it.  How much the buffer saves
+// depends on the runtime: libc++abi writes straight into it, libstdc++
+// still builds each name in a temporary allocation first.
+[[nodiscard]] inline demangle_result demangle(safe_string mangled) noexcept
+{
+    detail::demangle_buffer& buffer = detail::thread_demangle_buffer;
+    std::size_t length = buffer.capacity;
+    int status = demangle_error::invalid_argument;
+    char* out = abi::__cxa_demangle(mangled.c_str(), buffer.data, buffer.data ? &length : nullptr, &status);
+    if (!out)
+    {
+        return {status, mangled};
+    }
+    // On growth the old buffer has been freed and length is the size of the
+    // new one.
+    buffer.data     = out;
+    buffer.capacity = length;
+    return {status, out};
+}
+
+/*
+demangler memoizes demangle(): each distinct mangled name is demangled
+once and both names are interned in string_tables, so a profiler that
+symbolizes millions of frames pays for the unique symbols only.  The
+returned names stay valid for the lifetime of the demangler.
+
+Failures are remembered too; their name is the (interned) input, which is
+what a symbolizer prints for C symbols.
+
+    cinter::demangler names;
+    for (const frame& f : frames)
+    {
+        print(names.demangle(f.symbol).name);
+    }
+
+demangler is thread safe.  Hits take a shared lock; a miss demangles into
+the calling thread's buffer without holding the lock and then interns the
+result under an exclusive one.
+*/
+class demangler
+{
+    struct entry
+    {
+        string_table::id_type name;
+        int                   status;
+    };
+
+    mutable std::shared_mutex lock_;
+    string_table              mangled_;
+    string_table              names_;
+    // Indexed by the id of the mangled name.
+    std::vector<entry>        entries_;
+
+    [[nodiscard]] demangle_result result(string_table::id_type id) const noexcept
+    {
+        const entry& e = entries_[id];
+        return {e.status, e.status == 0 ? names_[e.name] : mangled_[id]};
+    }
+
+public:
+    demangler() = default;
+
+    demangler(const demangler& other) = delete;
+    demangler& operator=(const demangler& other) = delete;
+
+    [[nodiscard]] demangle_result demangle(safe_string mangled)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(lock_);
+            const string_table::find_result found = mangled_.find(mangled);
+            if (found.is_ok())
+            {
+                return result(found.value());
+            }
+        }
+
+        const demangle_result fresh = cinter::demangle(mangled);
+        // Memory failures are not remembered so that a later call retries.
+        if (fresh.status.value() == demangle_error::memory_failure)
+        {
+            return fresh;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        const std::size_t known = mangled_.size();
+        const string_table::id_type id = mangled_.intern(mangled);
+        if (id == known)
+        {
+            const bool ok = fresh.status.is_ok();
+            entries_.push_back(entry{ok ? names_.intern(fresh.name) : string_table::npos, fresh.status.value()});
+        }
+        return result(id);
+    }
+
+    // Number of distinct mangled names seen.
+    [[nodiscard]] std::size_t size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(lock_);
+        return mangled_.size();
+    }
+};
+
+} // namespace cinter
@@ -0,0 +1,274 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#ifdef __cpp_lib_ranges
+#include <ranges>
+#endif
+
+namespace cinter
+{
+
+namespace detail
+{
+
+// Elements of a generator_range: C strings become safe strings, anything
+// else (dirent*, passwd*, ...) is passed through.
+template <typename T>
+struct generated_element
+{
+    using type = T;
+};
+
+template <>
+struct generated_element<char*>
+{
+    using type = safe_string;
+};
+
+template <>
+struct generated_element<const char*>
+{
+    using type = safe_string;
+};
+
+template <>
+struct generated_element<wchar_t*>
+{
+    using type = safe_wstring;
+};
+
+template <>
+struct generated_element<const wchar_t*>
+{
+    using type = safe_wstring;
+};
+
+// Result type of generate_until_sentinel: the one given, or by default one
+// that ends at a null pointer.
+template <typename Result, typename T>
+struct generator_result
+{
+    using type = Result;
+};
+
+template <typename T>
+struct generator_result<void, T>
+{
+    static_assert(std::is_pointer_v<T>,
+                  "generators that do not return a pointer need an explicit sentinel_result type");
+    using type = sentinel_result<T, nullptr, not_equal_to<T>>;
+};
+
+} // namespace detail
+
+// End of a generator_range.
+struct generator_end
+{
+};
+
+/*
+generator_range turns a pull-style C function that signals the end with a
+sentinel value (readdir, getpwent, getmntent, fgets, strtok_r, ...) into a
+single-pass input range.  Each increment calls the generator once and the
+result is checked with the sentinel_result type Result, so the loop does
+exactly what the hand-written one does: call, compare, use.  Nothing is
+buffered.  Strings are yielded as safe strings, other pointers as they are.
+
+Use generate_until_sentinel() to make one:
+
+    DIR* d = opendir(path);
+    for (const dirent* e : cinter::generate_until_sentinel([d] { return readdir(d); }))
+    {
+        ...
+    }
+
+    char line[256];
+    for (cinter::safe_string s : cinter::generate_until_sentinel([&] { return fgets(line, sizeof(line), f); }))
+    {
+        ...
+    }
+
+    // Functions returning a value rather than a pointer need the Result type.
+    using char_result = cinter::sentinel_result<int, EOF, cinter::not_equal_to<int>>;
+    for (int c : cinter::generate_until_sentinel<char_result>([f] { return std::fgetc(f); }))
+    {
+        ...
+    }
+
+With C++20 it is a std::ranges::view and composes with range adaptors, e.g.
+generate_until_sentinel(...) | std::views::take(10).  begin() may only be
+called once, and iterators are invalidated if the range is moved.
+*/
+template <typename Result, typename Generator>
+class generator_range
+{
+public:
+    using result_type = Result;
+    using raw_type    = typename Result::value_type;
+    using value_type  = typename detail::generated_element<raw_type>::type;
+
+private:
+    // optional so that the range stays assignable (as a view must be) when
+    // the generator is a lambda, whose closure type is not.
+    std::optional<Generator> generator_;
+
+public:
+    class iterator
+    {
+        generator_range* range_ = nullptr;
+        raw_type         current_{};
+
+        friend class generator_range;
+
+        iterator(generator_range* range, raw_type current) noexcept : range_(range), current_(current) {}
+
+    public:
+        using iterator_concept  = std::input_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = generator_range::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+        iterator() noexcept = default;
+
+        [[nodiscard]] value_type operator*() const noexcept { return value_type(current_); }
+
+        // The value exactly as the generator returned it.
+        [[nodiscard]] raw_type raw() const noexcept { return current_; }
+
+        iterator& operator++()
+        {
+            current_ = (*range_->generator_)();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        [[nodiscard]] friend bool operator==(const iterator& it, generator_end) noexcept
+        {
+            return Result(it.current_).has_error();
+        }
+
+        [[nodiscard]] friend bool operator==(generator_end, const iterator& it) noexcept
+        {
+            return Result(it.current_).has_error();
+        }
+
+        [[nodiscard]] friend bool operator!=(const iterator& it, generator_end) noexcept
+        {
+            return Result(it.current_).is_ok();
+        }
+
+        [[nodiscard]] friend bool operator!=(generator_end, const iterator& it) noexcept
+        {
+            return Result(it.current_).is_ok();
+        }
+    };
+
+    generator_range() = default;
+    explicit generator_range(Generator generator) : generator_(std::move(generator)) {}
+
+    generator_range(const generator_range& other) = default;
+    generator_range(generator_range&& other) = default;
+
+    generator_range& operator=(const generator_range& other)
+    {
+        if (this != &other)
+        {
+            assign(other.generator_);
+        }
+        return *this;
+    }
+
+    generator_range& operator=(generator_range&& other)
+    {
+        if (this != &other)
+        {
+            assign(std::move(other.generator_));
+        }
+        return *this;
+    }
+
+    ~generator_range() = default;
+
+    // Calls the generator for the first element.
+    [[nodiscard]] iterator begin()
+    {
+        return iterator(this, (*generator_)());
+    }
+
+    [[nodiscard]] generator_end end() const noexcept { return {}; }
+
+private:
+    template <typename Optional>
+    void assign(Optional&& other)
+    {
+        if (other)
+        {
+            generator_.emplace(*std::forward<Optional>(other));
+        }
+        else
+        {
+            generator_.reset();
+        }
+    }
+};
+
+// Returns a generator_range calling generator until it returns a value for
+// which Result::is_ok() is false.  Result defaults to treating a null
+// pointer as the end.
+template <typename Result = void, typename Generator>
+[[nodiscard]] auto generate_until_sentinel(Generator generator)
+{
+    using result_type = typename detail::generator_result<Result, std::invoke_result_t<Generator&>>::type;
+    return generator_range<result_type, Generator>(std::move(generator));
+}
+
+} // namespace cinter
+
+#ifdef __cpp_lib_ranges
+namespace std::ranges
+{
+template <typename Result, typename Generator>
+inline constexpr bool enable_view<cinter::generator_range<Result, Generator>> = true;
+} // namespace std::ranges
+#endif
@@ -0,0 +1,1023 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "hash.hpp"
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace cinter
+{
+
+// Matching flags for glob_set, mirroring the fnmatch() flags of the same
+// name.  With pathname, '/' in the string is only matched by a '/' in the
+// pattern, never by '*', '?' or a bracket expression.
+enum class glob_flags : unsigned
+{
+    none     = 0,
+    pathname = 1
+};
+
+/*
+glob_set compiles a set of fnmatch() patterns once and then matches
+strings against all of them in a single pass.  Patterns support '*', '?',
+bracket expressions ("[a-z]", "[!0-9]", "[[:alpha:]]") and backslash
+escapes, with the semantics of fnmatch(pattern, string, 0), or of
+FNM_PATHNAME when glob_flags::pathname is given.  Classes are evaluated in
+the "C" locale.  Malformed bracket expressions ("[a-", "[[:!]", "[ab")
+are treated as glibc treats them.  Two glibc quirks are not reproduced.
+With FNM_PATHNAME, glibc never matches an escaped '/' that follows a '*';
+here it matches '/'.  And in a malformed expression that glibc ends at
+different places for different characters (in "[![*-[:alpha:]", 'x' ends
+it at the last ']' but '[' makes it a literal), only the characters that
+share the continuation of the lowest one it accepts are matched here.
+
+Most patterns in ignore lists are literals ("Makefile"), prefixes
+("build/" followed by '*') or suffixes ("*.o", "*~").  Those are bucketed
+by literal length into hash tables, so a lookup costs one hash per distinct
+literal length, independent of the number of patterns.  For the remaining
+patterns, an Aho-Corasick automaton over their longest literal runs is
+advanced in the same pass that measures the string, and only patterns
+whose literal occurs are then matched in full.
+
+    const cinter::safe_string patterns[] = {"*.o", "*.tmp", "core.[0-9]*", "*~"};
+    cinter::glob_set ignore(patterns, std::size(patterns));
+    if (ignore.matches_any(path)) { continue; }
+    ignore.for_each_match(path, [](cinter::glob_set::id_type id) { ... });
+
+Pattern ids are indices into the array given to the constructor.
+*/
+class glob_set
+{
+public:
+    using id_type = std::uint32_t;
+
+    static constexpr id_type npos = static_cast<id_type>(-1);
+
+    using find_result = sentinel_result<id_type, npos, not_equal_to<id_type>>;
+
+private:
+    enum class token_kind : std::uint8_t
+    {
+        literal,
+        any,     // ?
+        star,    // *, repeated stars collapsed
+        set      // bracket expression
+    };
+
+    struct token
+    {
+        token_kind    kind;
+        unsigned char ch;    // literal
+        std::uint32_t set;   // index into sets_
+    };
+
+    struct char_set
+    {
+        std::uint64_t bits[4] = {};
+
+        void add(unsigned char c) noexcept { bits[c >> 6] |= std::uint64_t{1} << (c & 63); }
+
+        [[nodiscard]] bool contains(unsigned char c) const noexcept
+        {
+            return (bits[c >> 6] >> (c & 63)) & 1;
+        }
+    };
+
+    // A pattern that is neither a literal, a prefix nor a suffix.
+    struct general_pattern
+    {
+        id_type          id;
+        std::uint32_t    first_token;
+        std::uint32_t    token_count;
+        std::string_view head;   // literal text before the first wildcard
+        std::string_view tail;   // literal text after the last wildcard
+    };
+
+    using literal_map = std::unordered_map<std::string_view, id_type, safe_string_hash>;
+
+    // Literals of one length.  Patterns sharing a literal are chained
+    // through next_same_.
+    struct bucket
+    {
+        std::size_t length;
+        literal_map heads;
+    };
+
+    glob_flags                   flags_;
+    std::unique_ptr<char[]>      text_;
+    literal_map                  exact_;
+    std::vector<bucket>          prefixes_;   // sorted by length
+    std::vector<bucket>          suffixes_;   // sorted by length
+    std::vector<general_pattern> general_;
+    std::vector<token>           tokens_;
+    std::vector<char_set>        sets_;
+    std::vector<id_type>         next_same_;
+    std::size_t                  pattern_count_ = 0;
+
+    // Aho-Corasick automaton over the longest literal run of each general
+    // pattern.  Bytes that occur in no literal share class 0, which keeps
+    // the transition table small.  State s has outputs
+    // outputs_[output_begin_[s] .. output_begin_[s + 1]), which are indices
+    // into general_.  Patterns without a literal are always candidates.
+    std::uint16_t              byte_class_[256] = {};
+    std::size_t                class_count_     = 1;
+    std::vector<std::uint32_t> delta_;
+    std::vector<std::uint32_t> output_begin_;
+    std::vector<std::uint32_t> outputs_;
+    std::vector<std::uint64_t> always_;   // bitmap over general_
+
+    [[nodiscard]] static unsigned count_trailing_zeros64(std::uint64_t bits) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(bits));
+#endif
+    }
+
+    [[nodiscard]] bool pathname() const noexcept
+    {
+        return (static_cast<unsigned>(flags_) & static_cast<unsigned>(glob_flags::pathname)) != 0;
+    }
+
+    // Adds the POSIX class named by [name, name + length) to s.  Classes
+    // are evaluated in the "C" locale.
+    static bool add_class(char_set& s, const char* name, std::size_t length)
+    {
+        const std::string_view n(name, length);
+        for (unsigned c = 1; c < 128; ++c)
+        {
+            const bool upper = c >= 'A' && c <= 'Z';
+            const bool lower = c >= 'a' && c <= 'z';
+            const bool digit = c >= '0' && c <= '9';
+            const bool space = c == ' ' || (c >= '\t' && c <= '\r');
+            const bool cntrl = c < 32 || c == 127;
+            const bool print = !cntrl;
+            const bool alnum = upper || lower || digit;
+            bool       in;
+            if (n == "alpha") in = upper || lower;
+            else if (n == "digit") in = digit;
+            else if (n == "alnum") in = alnum;
+            else if (n == "upper") in = upper;
+            else if (n == "lower") in = lower;
+            else if (n == "space") in = space;
+            else if (n == "blank") in = c == ' ' || c == '\t';
+            else if (n == "punct") in = print && c != ' ' && !alnum;
+            else if (n == "print") in = print;
+            else if (n == "graph") in = print && c != ' ';
+            else if (n == "cntrl") in = cntrl;
+            else if (n == "xdigit") in = digit || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f');
+            else return false;
+            if (in)
+            {
+                s.add(static_cast<unsigned char>(c));
+            }
+        }
+        return true;
+    }
+
+    // How a bracket expression treats one character.
+    enum class bracket_outcome : std::uint8_t
+    {
+        accept,    // matched; the expression ends at end
+        reject,    // not matched, or the expression is malformed
+        literal    // the expression is not terminated; '[' is a literal
+    };
+
+    // Class names longer than glibc's limit make the pattern malformed.
+    static constexpr std::size_t max_class_length = 256;
+
+    // Skips what follows the element of a bracket expression that matched,
+    // the way fnmatch() does, and sets end to the position after the
+    // closing ']'.  Returns accept, or reject or literal for a malformed or
+    // unterminated expression.
+    static bracket_outcome skip_bracket(const char* p, const char*& end)
+    {
+        unsigned char c;
+        do
+        {
+            c = static_cast<unsigned char>(*p++);
+            if (c == 0)
+            {
+                return bracket_outcome::literal;
+            }
+            if (c == '\\')
+            {
+                if (*p == 0)
+                {
+                    return bracket_outcome::reject;
+                }
+                ++p;
+            }
+            else if (c == '[' && *p == ':')
+            {
+                const char* start  = p;
+                std::size_t length = 0;
+                for (;;)
+                {
+                    c = static_cast<unsigned char>(*++p);
+                    if (++length == max_class_length)
+                    {
+                        return bracket_outcome::reject;
+                    }
+                    if (*p == ':' && p[1] == ']')
+                    {
+                        p += 2;
+                        break;
+                    }
+                    if (c < 'a' || c >= 'z')
+                    {
+                        // Not a class: carry on after the '['.
+                        p = start;
+                        c = '[';
+                        break;
+                    }
+                }
+            }
+            else if (c == '[' && *p == '=')
+            {
+                if (p[1] == 0 || p[2] != '=' || p[3] != ']')
+                {
+                    return bracket_outcome::reject;
+                }
+                p += 4;
+            }
+            else if (c == '[' && *p == '.')
+            {
+                const char* symbol_end = std::strstr(p + 1, ".]");
+                if (!symbol_end)
+                {
+                    return bracket_outcome::reject;
+                }
+                p = symbol_end + 2;
+            }
+        } while (c != ']');
+        end = p;
+        return bracket_outcome::accept;
+    }
+
+    // Reads a collating symbol "[.c.]" whose '[' is at p[-1].  In the "C"
+    // locale it must name a single character.  Returns the position after
+    // it, or nullptr if it is malformed.
+    static const char* read_collating_symbol(const char* p, unsigned char& c)
+    {
+        const char* end = std::strstr(p + 1, ".]");
+        if (end != p + 2)
+        {
+            return nullptr;
+        }
+        c = static_cast<unsigned char>(p[1]);
+        return end + 2;
+    }
+
+    // Matches fn against the bracket expression starting after the '[' at
+    // p.  This follows glibc's fnmatch() in the "C" locale step by step,
+    // because how it treats a malformed expression depends on the
+    // character: an unterminated range ("[a-") or unknown class fails the
+    // pattern, an unterminated expression ("[ab") makes the '[' a literal,
+    // and an element that is not a class ("[[:!]") is taken character by
+    // character, but only for characters not matched by an earlier element.
+    static bracket_outcome match_bracket(const char* p, unsigned char fn, const char*& end)
+    {
+        const bool negate = *p == '!' || *p == '^';
+        if (negate)
+        {
+            ++p;
+        }
+        const auto matched = [&](const char* rest) {
+            const bracket_outcome skipped = skip_bracket(rest, end);
+            return skipped == bracket_outcome::accept && negate ? bracket_outcome::reject : skipped;
+        };
+        unsigned char c = static_cast<unsigned char>(*p++);
+        for (;;)
+        {
+            // Set to the character of an element that may start a range.
+            bool          single = false;
+            unsigned char first  = 0;
+            if (c == '\\')
+            {
+                if (*p == 0)
+                {
+                    return bracket_outcome::reject;
+                }
+                c      = static_cast<unsigned char>(*p++);
+                single = true;
+            }
+            else if (c == '[' && *p == ':')
+            {
+                const char* start = p;
+                std::string name;
+                for (;;)
+                {
+                    if (name.size() == max_class_length)
+                    {
+                        return bracket_outcome::reject;
+                    }
+                    c = static_cast<unsigned char>(*++p);
+                    if (c == ':' && p[1] == ']')
+                    {
+                        p += 2;
+                        break;
+                    }
+                    if (c < 'a' || c >= 'z')
+                    {
+                        p      = start;
+                        c      = '[';
+                        single = true;
+                        break;
+                    }
+                    name.push_back(static_cast<char>(c));
+                }
+                if (!single)
+                {
+                    char_set members;
+                    if (!add_class(members, name.data(), name.size()))
+                    {
+                        return bracket_outcome::reject;
+                    }
+                    if (members.contains(fn))
+                    {
+                        return matched(p);
+                    }
+                    c = static_cast<unsigned char>(*p++);
+                }
+            }
+            else if (c == '[' && *p == '=')
+            {
+                // An equivalence class is its one character in the "C"
+                // locale; anything else makes the '[' an ordinary member.
+                if (p[1] != 0 && p[2] == '=' && p[3] == ']')
+                {
+                    const unsigned char member = static_cast<unsigned char>(p[1]);
+                    p += 4;
+                    if (member == fn)
+                    {
+                        return matched(p);
+                    }
+                    c = static_cast<unsigned char>(*p++);
+                }
+                else
+                {
+                    single = true;
+                }
+            }
+            else if (c == 0)
+            {
+                return bracket_outcome::literal;
+            }
+            else if (c == '[' && *p == '.')
+            {
+                p = read_collating_symbol(p, first);
+                if (!p)
+                {
+                    return bracket_outcome::reject;
+                }
+                // Unlike a plain character, a symbol followed by "-]" is
+                // taken to start a range and so is not matched itself.
+                if (!(*p == '-' && p[1] != 0) && first == fn)
+                {
+                    return matched(p);
+                }
+                c = static_cast<unsigned char>(*p++);
+            }
+            else
+            {
+                single = true;
+            }
+            if (single)
+            {
+                if (!(*p == '-' && p[1] != 0 && p[1] != ']') && c == fn)
+                {
+                    return matched(p);
+                }
+                first = c;
+                c     = static_cast<unsigned char>(*p++);
+            }
+            if (first != 0 && c == '-' && *p != ']')
+            {
+                unsigned char last = static_cast<unsigned char>(*p++);
+                if (last == '[' && *p == '.')
+                {
+                    p = read_collating_symbol(p, last);
+                    if (!p)
+                    {
+                        return bracket_outcome::reject;
+                    }
+                }
+                else if (last == '\\')
+                {
+                    last = static_cast<unsigned char>(*p++);
+                }
+                if (last == 0)
+                {
+                    return bracket_outcome::reject;
+                }
+                if (first <= fn && fn <= last)
+                {
+                    return matched(p);
+                }
+                c = static_cast<unsigned char>(*p++);
+            }
+            if (c == ']')
+            {
+                break;
+            }
+        }
+        end = p;
+        return negate ? bracket_outcome::accept : bracket_outcome::reject;
+    }
+
+    // Ends a malformed pattern with an empty set, which matches nothing.
+    void never_match(std::vector<token>& out)
+    {
+        out.push_back({token_kind::set, 0, static_cast<std::uint32_t>(sets_.size())});
+        sets_.push_back(char_set{});
+    }
+
+    void tokenize(const char* p, std::vector<token>& out)
+    {
+        const std::size_t first = out.size();
+        while (*p)
+        {
+            const char c = *p++;
+            if (c == '*')
+            {
+                if (out.size() == first || out.back().kind != token_kind::star)
+                {
+                    out.push_back({token_kind::star, 0, 0});
+                }
+            }
+            else if (c == '?')
+            {
+                out.push_back({token_kind::any, 0, 0});
+            }
+            else if (c == '[')
+            {
+                char_set    s;
+                const char* end     = nullptr;
+                bool        literal = false;
+                for (unsigned k = 1; k < 256; ++k)
+                {
+                    if (k == '/' && pathname())
+                    {
+                        continue;
+                    }
+                    const char* k_end = nullptr;
+                    switch (match_bracket(p, static_cast<unsigned char>(k), k_end))
+                    {
+                        case bracket_outcome::accept:
+                            // The rest of the pattern must be the same for
+                            // every character in the set; see the class
+                            // comment.
+                            if (!end || k_end == end)
+                            {
+                                s.add(static_cast<unsigned char>(k));
+                                end = k_end;
+                            }
+                            break;
+                        case bracket_outcome::literal:
+                            literal = literal || k == '[';
+                            break;
+                        case bracket_outcome::reject:
+                            break;
+                    }
+                }
+                if (end)
+                {
+                    out.push_back({token_kind::set, 0, static_cast<std::uint32_t>(sets_.size())});
+                    sets_.push_back(s);
+                    p = end;
+                }
+                else if (literal)
+                {
+                    out.push_back({token_kind::literal, '[', 0});
+                }
+                else
+                {
+                    never_match(out);
+                    return;
+                }
+            }
+            else if (c == '\\')
+            {
+                // fnmatch() rejects a trailing backslash.
+                if (*p == 0)
+                {
+                    never_match(out);
+                    return;
+                }
+                out.push_back({token_kind::literal, static_cast<unsigned char>(*p++), 0});
+            }
+            else
+            {
+                out.push_back({token_kind::literal, static_cast<unsigned char>(c), 0});
+            }
+        }
+    }
+
+    static void add_to_buckets(std::vector<bucket>& buckets, std::string_view literal, id_type id,
+                               std::vector<id_type>& next_same)
+    {
+        auto it = std::find_if(buckets.begin(), buckets.end(),
+                               [&](const bucket& b) { return b.length == literal.size(); });
+        if (it == buckets.end())
+        {
+            buckets.push_back({literal.size(), {}});
+            it = buckets.end() - 1;
+        }
+        add_to_map(it->heads, literal, id, next_same);
+    }
+
+    static void add_to_map(literal_map& map, std::string_view literal, id_type id, std::vector<id_type>& next_same)
+    {
+        auto [it, inserted] = map.emplace(literal, id);
+        if (!inserted)
+        {
+            next_same[id] = it->second;
+            it->second    = id;
+        }
+    }
+
+    template <typename Fn>
+    bool visit_chain(id_type id, Fn& fn) const
+    {
+        for (; id != npos; id = next_same_[id])
+        {
+            if (!fn(id))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Matches tokens against s.  On a mismatch after a star, the star
+    // absorbs one more character and matching resumes; one backtracking
+    // point suffices because a later star can always reproduce what an
+    // earlier one would have consumed.  With pathname a star cannot absorb
+    // '/', which makes the same argument hold per path segment.
+    [[nodiscard]] bool match_tokens(const token* t, std::size_t count, const unsigned char* s) const noexcept
+    {
+        const bool           no_slash  = pathname();
+        std::size_t          ti        = 0;
+        std::size_t          star_ti   = static_cast<std::size_t>(-1);
+        const unsigned char* star_s    = nullptr;
+        for (;;)
+        {
+            if (ti < count)
+            {
+                const token& k = t[ti];
+                if (k.kind == token_kind::star)
+                {
+                    star_ti = ++ti;
+                    star_s  = s;
+                    continue;
+                }
+                if (*s != 0)
+                {
+                    bool ok;
+                    switch (k.kind)
+                    {
+                        case token_kind::literal: ok = *s == k.ch; break;
+                        case token_kind::any: ok = !(no_slash && *s == '/'); break;
+                        default: ok = sets_[k.set].contains(*s); break;
+                    }
+                    if (ok)
+                    {
+                        ++ti;
+                        ++s;
+                        continue;
+                    }
+                }
+            }
+            else if (*s == 0)
+            {
+                return true;
+            }
+            if (!star_s || *star_s == 0 || (no_slash && *star_s == '/'))
+            {
+                return false;
+            }
+            ti = star_ti;
+            s  = ++star_s;
+        }
+    }
+
+    void build(const safe_string* patterns, std::size_t count)
+    {
+        pattern_count_ = count;
+        next_same_.assign(count, npos);
+
+        enum class shape
+        {
+            exact,
+            prefix,
+            suffix,
+            general
+        };
+        struct parsed
+        {
+            shape       kind;
+            std::size_t first_token;
+            std::size_t token_count;
+        };
+        std::vector<parsed> parsed_patterns;
+        parsed_patterns.reserve(count);
+        std::size_t text_size = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t first = tokens_.size();
+            tokenize(patterns[i].c_str(), tokens_);
+            const std::size_t n     = tokens_.size() - first;
+            std::size_t       stars = 0;
+            bool              other = false;
+            for (std::size_t k = first; k < tokens_.size(); ++k)
+            {
+                stars += tokens_[k].kind == token_kind::star;
+                other |= tokens_[k].kind == token_kind::any || tokens_[k].kind == token_kind::set;
+            }
+            shape kind = shape::general;
+            if (!other && stars == 0)
+            {
+                kind = shape::exact;
+            }
+            else if (!other && stars == 1 && tokens_[first + n - 1].kind == token_kind::star)
+            {
+                kind = shape::prefix;
+            }
+            else if (!other && stars == 1 && tokens_[first].kind == token_kind::star)
+            {
+                kind = shape::suffix;
+            }
+            parsed_patterns.push_back({kind, first, n});
+            text_size += n;
+        }
+
+        // Unescaped literal text of every pattern, in one block so that
+        // the string_view keys survive moves of the set.
+        text_.reset(new char[text_size + 1]);
+        char* out = text_.get();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const parsed& p = parsed_patterns[i];
+            const auto    id = static_cast<id_type>(i);
+            char* const   begin = out;
+            std::size_t   head  = 0;
+            std::size_t   tail  = 0;
+            bool          in_head = true;
+            for (std::size_t k = p.first_token; k < p.first_token + p.token_count; ++k)
+            {
+                if (tokens_[k].kind == token_kind::literal)
+                {
+                    *out++ = static_cast<char>(tokens_[k].ch);
+                    head += in_head;
+                    ++tail;
+                }
+                else
+                {
+                    in_head = false;
+                    tail    = 0;
+                }
+            }
+            const std::string_view literal(begin, static_cast<std::size_t>(out - begin));
+            switch (p.kind)
+            {
+                case shape::exact: add_to_map(exact_, literal, id, next_same_); break;
+                case shape::prefix: add_to_buckets(prefixes_, literal, id, next_same_); break;
+                case shape::suffix: add_to_buckets(suffixes_, literal, id, next_same_); break;
+                case shape::general:
+                    general_.push_back({id, static_cast<std::uint32_t>(p.first_token),
+                                        static_cast<std::uint32_t>(p.token_count), literal.substr(0, head),
+                                        literal.substr(literal.size() - tail)});
+                    break;
+            }
+        }
+        auto by_length = [](const bucket& a, const bucket& b) { return a.length < b.length; };
+        std::sort(prefixes_.begin(), prefixes_.end(), by_length);
+        std::sort(suffixes_.begin(), suffixes_.end(), by_length);
+        build_filter();
+    }
+
+    void build_filter()
+    {
+        // Longest run of literal tokens per general pattern.
+        std::vector<std::string> required(general_.size());
+        for (std::size_t g = 0; g < general_.size(); ++g)
+        {
+            std::string run;
+            for (std::size_t k = general_[g].first_token; k < general_[g].first_token + general_[g].token_count; ++k)
+            {
+                if (tokens_[k].kind == token_kind::literal)
+                {
+                    run += static_cast<char>(tokens_[k].ch);
+                }
+                else
+                {
+                    run.clear();
+                }
+                if (run.size() > required[g].size())
+                {
+                    required[g] = run;
+                }
+            }
+            for (unsigned char c : required[g])
+            {
+                if (byte_class_[c] == 0)
+                {
+                    byte_class_[c] = static_cast<std::uint16_t>(class_count_++);
+                }
+            }
+        }
+
+        // Trie, then failure links and the full transition table in
+        // breadth-first order.
+        const std::size_t                       classes = class_count_;
+        std::vector<std::uint32_t>              trie(classes, 0);
+        std::vector<std::vector<std::uint32_t>> outputs(1);
+        always_.assign((general_.size() + 63) / 64, 0);
+        for (std::size_t g = 0; g < general_.size(); ++g)
+        {
+            if (required[g].empty())
+            {
+                always_[g / 64] |= std::uint64_t{1} << (g % 64);
+                continue;
+            }
+            std::uint32_t state = 0;
+            for (unsigned char c : required[g])
+            {
+                std::uint32_t& next = trie[state * classes + byte_class_[c]];
+                if (next == 0)
+                {
+                    next = static_cast<std::uint32_t>(outputs.size());
+                    outputs.emplace_back();
+                    trie.resize(trie.size() + classes, 0);
+                }
+                state = trie[state * classes + byte_class_[c]];
+            }
+            outputs[state].push_back(static_cast<std::uint32_t>(g));
+        }
+
+        delta_.assign(trie.size(), 0);
+        std::vector<std::uint32_t> fail(outputs.size(), 0);
+        std::vector<std::uint32_t> queue;
+        for (std::size_t c = 0; c < classes; ++c)
+        {
+            delta_[c] = trie[c];
+            if (trie[c] != 0)
+            {
+                queue.push_back(trie[c]);
+            }
+        }
+        for (std::size_t head = 0; head < queue.size(); ++head)
+        {
+            const std::uint32_t state = queue[head];
+            const auto&         inherited = outputs[fail[state]];
+            outputs[state].insert(outputs[state].end(), inherited.begin(), inherited.end());
+            for (std::size_t c = 0; c < classes; ++c)
+            {
+                const std::uint32_t child = trie[state * classes + c];
+                if (child != 0)
+                {
+                    fail[child] = delta_[fail[state] * classes + c];
+                    delta_[state * classes + c] = child;
+                    queue.push_back(child);
+                }
+                else
+                {
+                    delta_[state * classes + c] = delta_[fail[state] * classes + c];
+                }
+            }
+        }
+
+        output_begin_.assign(1, 0);
+        for (const auto& o : outputs)
+        {
+            outputs_.insert(outputs_.end(), o.begin(), o.end());
+            output_begin_.push_back(static_cast<std::uint32_t>(outputs_.size()));
+        }
+    }
+
+    // Calls fn(id) for each matching pattern until fn returns false.
+    // Returns false if fn stopped the iteration.
+    template <typename Fn>
+    bool visit(safe_string string, Fn&& fn) const
+    {
+        // One pass for the length, the first and last '/' and, if there
+        // are general patterns, the candidates among them.
+        const char* const          s           = string.c_str();
+        std::size_t                length      = 0;
+        std::size_t                first_slash = static_cast<std::size_t>(-1);
+        std::size_t                last_slash  = static_cast<std::size_t>(-1);
+        const std::size_t          words       = always_.size();
+        std::uint64_t              local[8];
+        std::vector<std::uint64_t> heap;   // only for more than 512 general patterns
+        std::uint64_t*             candidates = local;
+        if (words > 8)
+        {
+            heap.resize(words);
+            candidates = heap.data();
+        }
+        std::copy(always_.begin(), always_.end(), candidates);
+        if (general_.empty())
+        {
+            for (; s[length] != 0; ++length)
+            {
+                if (s[length] == '/')
+                {
+                    first_slash = std::min(first_slash, length);
+                    last_slash  = length;
+                }
+            }
+        }
+        else
+        {
+            std::uint32_t state = 0;
+            for (; s[length] != 0; ++length)
+            {
+                const auto c = static_cast<unsigned char>(s[length]);
+                if (c == '/')
+                {
+                    first_slash = std::min(first_slash, length);
+                    last_slash  = length;
+                }
+                state = delta_[state * class_count_ + byte_class_[c]];
+                for (std::uint32_t k = output_begin_[state]; k < output_begin_[state + 1]; ++k)
+                {
+                    candidates[outputs_[k] / 64] |= std::uint64_t{1} << (outputs_[k] % 64);
+                }
+            }
+        }
+        const std::string_view view(s, length);
+        const bool             no_slash = pathname();
+
+        if (!exact_.empty())
+        {
+            const auto it = exact_.find(view);
+            if (it != exact_.end() && !visit_chain(it->second, fn))
+            {
+                return false;
+            }
+        }
+        for (const bucket& b : prefixes_)
+        {
+            if (b.length > length)
+            {
+                break;
+            }
+            // With pathname the star may not absorb a '/'.
+            if (no_slash && last_slash != static_cast<std::size_t>(-1) && last_slash >= b.length)
+            {
+                continue;
+            }
+            const auto it = b.heads.find(view.substr(0, b.length));
+            if (it != b.heads.end() && !visit_chain(it->second, fn))
+            {
+                return false;
+            }
+        }
+        for (const bucket& b : suffixes_)
+        {
+            if (b.length > length)
+            {
+                break;
+            }
+            if (no_slash && first_slash != static_cast<std::size_t>(-1) && first_slash < length - b.length)
+            {
+                continue;
+            }
+            const auto it = b.heads.find(view.substr(length - b.length));
+            if (it != b.heads.end() && !visit_chain(it->second, fn))
+            {
+                return false;
+            }
+        }
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            for (std::uint64_t bits = candidates[w]; bits != 0; bits &= bits - 1)
+            {
+                const general_pattern& g = general_[w * 64 + count_trailing_zeros64(bits)];
+                if (g.head.size() + g.tail.size() > length || view.compare(0, g.head.size(), g.head) != 0
+                    || view.compare(length - g.tail.size(), g.tail.size(), g.tail) != 0)
+                {
+                    continue;
+                }
+                if (match_tokens(tokens_.data() + g.first_token, g.token_count,
+                                 reinterpret_cast<const unsigned char*>(s))
+                    && !fn(g.id))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+public:
+    glob_set(const safe_string* patterns, std::size_t count, glob_flags flags = glob_flags::none) : flags_(flags)
+    {
+        build(patterns, count);
+    }
+
+#ifdef __cpp_lib_span
+    explicit glob_set(std::span<const safe_string> patterns, glob_flags flags = glob_flags::none)
+        : glob_set(patterns.data(), patterns.size(), flags)
+    {
+    }
+#endif
+
+    glob_set(const glob_set& other) = delete;
+    glob_set& operator=(const glob_set& other) = delete;
+    glob_set(glob_set&& other) noexcept = default;
+    glob_set& operator=(glob_set&& other) noexcept = default;
+
+    // Returns true if any pattern matches.  Stops at the first match.
+    [[nodiscard]] bool matches_any(safe_string string) const
+    {
+        return !visit(string, [](id_type) { return false; });
+    }
+
+    // Returns the smallest id of a matching pattern, or npos (an error) if
+    // none matches.
+    [[nodiscard]] find_result first_match(safe_string string) const
+    {
+        id_type first = npos;
+        visit(string, [&](id_type id) {
+            first = std::min(first, id);
+            return true;
+        });
+        return first;
+    }
+
+    // Calls fn(id) for every matching pattern, in no particular order.
+    template <typename Fn>
+    void for_each_match(safe_string string, Fn fn) const
+    {
+        visit(string, [&](id_type id) {
+            fn(id);
+            return true;
+        });
+    }
+
+    // Replaces the contents of hits with the ids of all matching patterns
+    // in increasing order and returns how many there are.  Reusing hits
+    // across calls avoids allocating.
+    std::size_t match(safe_string string, std::vector<id_type>& hits) const
+    {
+        hits.clear();
+        for_each_match(string, [&](id_type id) { hits.push_back(id); });
+        std::sort(hits.begin(), hits.end());
+        return hits.size();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return pattern_count_; }
+};
+
+} // namespace cinter
@@ -0,0 +1,211 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace cinter
+{
+
+// Hash and length of a string computed together in one pass.
+struct hashed_length
+{
+    std::uint64_t hash;
+    std::size_t   length;
+};
+
+namespace detail
+{
+
+inline constexpr std::uint64_t fnv_offset_basis = 0xcbf29ce484222325ull;
+inline constexpr std::uint64_t fnv_prime        = 0x100000001b3ull;
+
+// FNV-1a has weak high bits; the finalizer from MurmurHash3 spreads every
+// input bit over the whole word so both low bits (table slots) and high
+// bits (tags, shard selection) are usable.
+[[nodiscard]] constexpr std::uint64_t mix_hash(std::uint64_t h) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+// Characters are mixed in as unsigned values, so a byte hashes the same
+// whether or not char is signed and hashes written to files are portable.
+template <typename Char>
+[[nodiscard]] constexpr std::uint64_t hash_step(std::uint64_t h, Char c) noexcept
+{
+    return (h ^ static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<Char>>(c))) * fnv_prime;
+}
+
+inline void prefetch(const void* p) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+} // namespace detail
+
+// Hashes a C-string while scanning for its terminator.  Hashing through
+// std::hash<std::string_view> would walk the string twice: once for the
+// length and once for the hash.
+template <typename Char>
+[[nodiscard]] constexpr hashed_length hash_with_length(basic_safe_string<Char> s) noexcept
+{
+    const Char*   p = s.c_str();
+    std::uint64_t h = detail::fnv_offset_basis;
+    std::size_t   n = 0;
+    while (p[n] != Char{})
+    {
+        h = detail::hash_step(h, p[n]);
+        ++n;
+    }
+    return {detail::mix_hash(h), n};
+}
+
+template <typename Char>
+[[nodiscard]] constexpr std::uint64_t hash_value(basic_safe_string<Char> s) noexcept
+{
+    return hash_with_length(s).hash;
+}
+
+// Produces the same value as the basic_safe_string overload for the same
+// characters so both can be used to probe one table.
+template <typename Char>
+[[nodiscard]] constexpr std::uint64_t hash_value(std::basic_string_view<Char> s) noexcept
+{
+    std::uint64_t h = detail::fnv_offset_basis;
+    for (Char c : s)
+    {
+        h = detail::hash_step(h, c);
+    }
+    return detail::mix_hash(h);
+}
+
+// Transparent hasher for unordered containers keyed by safe strings.
+template <typename Char = char>
+struct basic_safe_string_hash
+{
+    using is_transparent = void;
+
+    [[nodiscard]] std::size_t operator()(basic_safe_string<Char> s) const noexcept
+    {
+        return static_cast<std::size_t>(hash_value(s));
+    }
+
+    [[nodiscard]] std::size_t operator()(std::basic_string_view<Char> s) const noexcept
+    {
+        return static_cast<std::size_t>(hash_value(s));
+    }
+};
+
+using safe_string_hash = basic_safe_string_hash<char>;
+
+// How many items ahead the batch functions prefetch.  Far enough ahead to
+// cover a DRAM miss with several misses in flight, close enough that the
+// prefetched lines are still in L1 when they are used.
+inline constexpr std::size_t batch_prefetch_distance = 8;
+
+// Hashes keys[0..count) into out[0..count), prefetching the characters of
+// later keys so that the cache misses on the string bytes overlap.
+template <typename Char>
+void hash_batch(const basic_safe_string<Char>* keys, std::size_t count, std::uint64_t* out) noexcept
+{
+    const std::size_t ahead = count < batch_prefetch_distance ? count : batch_prefetch_distance;
+    for (std::size_t i = 0; i < ahead; ++i)
+    {
+        detail::prefetch(keys[i].c_str());
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i + batch_prefetch_distance < count)
+        {
+            detail::prefetch(keys[i + batch_prefetch_distance].c_str());
+        }
+        out[i] = hash_value(keys[i]);
+    }
+}
+
+#ifdef __cpp_lib_span
+template <typename Char>
+void hash_batch(std::span<const basic_safe_string<Char>> keys, std::span<std::uint64_t> out) noexcept
+{
+    hash_batch(keys.data(), keys.size() < out.size() ? keys.size() : out.size(), out.data());
+}
+
+// The template above only accepts a span of exactly that type; these take
+// anything convertible to one, such as a std::vector or std::array.
+inline void hash_batch(std::span<const safe_string> keys, std::span<std::uint64_t> out) noexcept
+{
+    hash_batch<char>(keys, out);
+}
+
+inline void hash_batch(std::span<const safe_wstring> keys, std::span<std::uint64_t> out) noexcept
+{
+    hash_batch<wchar_t>(keys, out);
+}
+#endif
+
+} // namespace cinter
+
+namespace std
+{
+
+template <typename Char>
+struct hash<cinter::basic_safe_string<Char>>
+{
+    [[nodiscard]] std::size_t operator()(cinter::basic_safe_string<Char> s) const noexcept
+    {
+        return static_cast<std::size_t>(cinter::hash_value(s));
+    }
+};
+
+} // namespace std
@@ -0,0 +1,269 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace cinter
+{
+
+/*
+hugepage_arena_resource is a std::pmr::memory_resource that carves
+allocations out of large chunks mapped with mmap(2).  Chunks are 2 MiB (or a
+multiple of it) so that they can be backed by huge pages, which cuts TLB
+misses for large string tables:
+
+  1. The chunk is first mapped with MAP_HUGETLB, which needs pages reserved in
+     /proc/sys/vm/nr_hugepages.
+  2. If that fails, an ordinary 2 MiB aligned mapping is made and
+     madvise(MADV_HUGEPAGE) asks for transparent huge pages.  If THP is
+     disabled this still works, just with 4 KiB pages.
+
+If a NUMA node is given, each chunk is bound to it with mbind(2) before it
+is touched.  A failed mbind (no NUMA support, invalid node) is not an error;
+the chunk is used with the default policy and numa_fallbacks() is
+incremented.
+
+Like std::pmr::monotonic_buffer_resource, deallocation is a no-op, memory is
+returned when the resource is destroyed or release() is called, and the
+resource is not thread safe.
+
+    cinter::hugepage_arena_resource::options opts;
+    opts.numa_node = 0;
+    cinter::hugepage_arena_resource arena(opts);
+    cinter::pmr::string_table table(&arena);
+    table.reserve(expected_count);  // growth of a monotonic arena is not reclaimed
+*/
+class hugepage_arena_resource : public std::pmr::memory_resource
+{
+public:
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+    struct options
+    {
+        // Rounded up to a multiple of huge_page_size.
+        std::size_t chunk_size = huge_page_size;
+        // NUMA node to bind chunks to, or -1 for the default policy.
+        int numa_node = -1;
+        // Try MAP_HUGETLB before falling back to transparent huge pages.
+        bool use_hugetlb = true;
+    };
+
+private:
+    struct chunk
+    {
+        void*       base;
+        std::size_t size;
+    };
+
+    options            options_;
+    std::vector<chunk> chunks_;
+    unsigned char*     next_          = nullptr;
+    std::size_t        remaining_     = 0;
+    std::size_t        hugetlb_chunks_ = 0;
+    std::size_t        numa_fallbacks_ = 0;
+
+    [[nodiscard]] static constexpr std::size_t round_up(std::size_t n, std::size_t multiple) noexcept
+    {
+        return (n + multiple - 1) / multiple * multiple;
+    }
+
+    [[nodiscard]] void* map_hugetlb(std::size_t size) noexcept
+    {
+#ifdef MAP_HUGETLB
+        void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+#else
+        (void)size;
+        return nullptr;
+#endif
+    }
+
+    // Over-maps by one huge page and trims both ends so the chunk is 2 MiB
+    // aligned, which transparent huge pages require.
+    [[nodiscard]] void* map_aligned(std::size_t size) noexcept
+    {
+        const std::size_t mapped = size + huge_page_size;
+        void*             p = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+        {
+            return nullptr;
+        }
+        const std::uintptr_t start   = reinterpret_cast<std::uintptr_t>(p);
+        const std::uintptr_t aligned = round_up(start, huge_page_size);
+        if (aligned != start)
+        {
+            ::munmap(p, aligned - start);
+        }
+        const std::size_t tail = mapped - (aligned - start) - size;
+        if (tail)
+        {
+            ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+        }
+#ifdef MADV_HUGEPAGE
+        ::madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void bind(void* base, std::size_t size) noexcept
+    {
+        if (options_.numa_node < 0)
+        {
+            return;
+        }
+        constexpr std::size_t bits_per_word = sizeof(unsigned long) * 8;
+        const std::size_t     node          = static_cast<std::size_t>(options_.numa_node);
+        unsigned long         mask[16]      = {};
+        if (node >= sizeof(mask) * 8)
+        {
+            ++numa_fallbacks_;
+            return;
+        }
+        mask[node / bits_per_word] = 1ul << (node % bits_per_word);
+        if (::syscall(SYS_mbind, base, size, MPOL_BIND, mask, sizeof(mask) * 8, 0) != 0)
+        {
+            ++numa_fallbacks_;
+        }
+    }
+
+    void add_chunk(std::size_t min_size)
+    {
+        const std::size_t size = round_up(min_size > options_.chunk_size ? min_size : options_.chunk_size,
+                                          huge_page_size);
+        void*             base = options_.use_hugetlb ? map_hugetlb(size) : nullptr;
+        if (base)
+        {
+            ++hugetlb_chunks_;
+        }
+        else
+        {
+            base = map_aligned(size);
+        }
+        if (!base)
+        {
+            throw std::bad_alloc{};
+        }
+        bind(base, size);
+        try
+        {
+            chunks_.push_back(chunk{base, size});
+        }
+        catch (...)
+        {
+            ::munmap(base, size);
+            throw;
+        }
+        next_      = static_cast<unsigned char*>(base);
+        remaining_ = size;
+    }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        std::size_t padding = static_cast<std::size_t>(-reinterpret_cast<std::uintptr_t>(next_) & (alignment - 1));
+        if (!next_ || padding + bytes > remaining_)
+        {
+            add_chunk(bytes + alignment);
+            padding = static_cast<std::size_t>(-reinterpret_cast<std::uintptr_t>(next_) & (alignment - 1));
+        }
+        void* p = next_ + padding;
+        next_ += padding + bytes;
+        remaining_ -= padding + bytes;
+        return p;
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        (void)p;
+        (void)bytes;
+        (void)alignment;
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    hugepage_arena_resource() : hugepage_arena_resource(options{}) {}
+    explicit hugepage_arena_resource(const options& opts) : options_(opts)
+    {
+        options_.chunk_size = round_up(options_.chunk_size ? options_.chunk_size : huge_page_size, huge_page_size);
+    }
+
+    hugepage_arena_resource(const hugepage_arena_resource& other) = delete;
+    hugepage_arena_resource& operator=(const hugepage_arena_resource& other) = delete;
+
+    ~hugepage_arena_resource() override
+    {
+        release();
+    }
+
+    // Unmaps every chunk.  Everything allocated from the resource is freed.
+    void release() noexcept
+    {
+        for (const chunk& c : chunks_)
+        {
+            ::munmap(c.base, c.size);
+        }
+        chunks_.clear();
+        next_      = nullptr;
+        remaining_ = 0;
+    }
+
+    [[nodiscard]] std::size_t chunk_count() const noexcept { return chunks_.size(); }
+
+    [[nodiscard]] std::size_t bytes_mapped() const noexcept
+    {
+        std::size_t total = 0;
+        for (const chunk& c : chunks_)
+        {
+            total += c.size;
+        }
+        return total;
+    }
+
+    // Chunks backed by MAP_HUGETLB pages rather than transparent huge pages.
+    [[nodiscard]] std::size_t hugetlb_chunks() const noexcept { return hugetlb_chunks_; }
+
+    // Chunks that could not be bound to the requested NUMA node.
+    [[nodiscard]] std::size_t numa_fallbacks() const noexcept { return numa_fallbacks_; }
+};
+
+} // namespace cinter
@@ -0,0 +1,118 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "bounded_safe_string.hpp"
+#include "record_range.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <linux/netlink.h>
+#include <sys/fanotify.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
+
+// record_range policies for the variable-length records returned by Linux
+// system calls.  This header is only usable on Linux.
+
+namespace cinter
+{
+
+// Layout of the records returned by getdents64(2).  glibc only exposes it as
+// struct dirent64 under _LARGEFILE64_SOURCE, so it is declared here.
+struct linux_dirent64
+{
+    std::uint64_t  d_ino;
+    std::int64_t   d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[1];
+};
+
+struct inotify_event_policy
+{
+    static constexpr std::size_t alignment = alignof(inotify_event);
+    static std::size_t record_length(const inotify_event& e) noexcept { return sizeof(inotify_event) + e.len; }
+};
+
+struct linux_dirent64_policy
+{
+    static constexpr std::size_t alignment = alignof(linux_dirent64);
+    static std::size_t record_length(const linux_dirent64& d) noexcept { return d.d_reclen; }
+};
+
+// Control messages in msghdr::msg_control, aligned as by CMSG_ALIGN.
+struct cmsghdr_policy
+{
+    static constexpr std::size_t alignment = sizeof(std::size_t);
+    static std::size_t record_length(const cmsghdr& c) noexcept { return c.cmsg_len; }
+};
+
+struct fanotify_event_policy
+{
+    static constexpr std::size_t alignment = 1;
+    static std::size_t record_length(const fanotify_event_metadata& m) noexcept { return m.event_len; }
+};
+
+struct nlmsghdr_policy
+{
+    static constexpr std::size_t alignment = NLMSG_ALIGNTO;
+    static std::size_t record_length(const nlmsghdr& h) noexcept { return h.nlmsg_len; }
+};
+
+using inotify_event_range  = record_range<inotify_event, inotify_event_policy>;
+using linux_dirent64_range = record_range<linux_dirent64, linux_dirent64_policy>;
+using cmsghdr_range        = record_range<cmsghdr, cmsghdr_policy>;
+using fanotify_event_range = record_range<fanotify_event_metadata, fanotify_event_policy>;
+using nlmsghdr_range       = record_range<nlmsghdr, nlmsghdr_policy>;
+
+// The name of an inotify event is padded with null characters up to len; it
+// is empty for events on the watched object itself.
+[[nodiscard]] inline bounded_safe_string event_name(const inotify_event& e) noexcept
+{
+    return bounded_safe_string(e.name, e.len);
+}
+
+[[nodiscard]] inline bounded_safe_string entry_name(const linux_dirent64& d) noexcept
+{
+    return bounded_safe_string(d.d_name, d.d_reclen - offsetof(linux_dirent64, d_name));
+}
+
+// Data of a control message, e.g. the file descriptors of SCM_RIGHTS.
+[[nodiscard]] inline const unsigned char* cmsg_payload(const cmsghdr& c) noexcept
+{
+    return CMSG_DATA(&c);
+}
+
+[[nodiscard]] inline std::size_t cmsg_payload_size(const cmsghdr& c) noexcept
+{
+    return c.cmsg_len - CMSG_LEN(0);
+}
+
+} // namespace cinter
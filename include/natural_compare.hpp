@@ -0,0 +1,272 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CINTER_NATURAL_COMPARE_SSE2 1
+#endif
+#if defined(__SANITIZE_ADDRESS__)
+#undef CINTER_NATURAL_COMPARE_SSE2
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#undef CINTER_NATURAL_COMPARE_SSE2
+#endif
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace cinter
+{
+
+namespace detail
+{
+
+// States of the glibc strverscmp() state machine, describing the digit run
+// that ends just before the current position.  Each is a multiple of three
+// so that adding the class of a character gives a table row.
+enum natural_state : std::uint8_t
+{
+    natural_normal     = 0, // not in a digit run
+    natural_integral   = 3, // in a digit run starting with 1-9
+    natural_fractional = 6, // in a digit run starting with 0 and holding a nonzero digit
+    natural_zeros      = 9  // in a digit run of zeros only
+};
+
+template <typename Char>
+[[nodiscard]] constexpr bool is_ascii_digit(Char c) noexcept
+{
+    return c >= Char('0') && c <= Char('9');
+}
+
+// 0 for other characters, 1 for nonzero digits and 2 for '0'.
+template <typename Char>
+[[nodiscard]] constexpr unsigned natural_class_of(Char c) noexcept
+{
+    return (c == Char('0')) + is_ascii_digit(c);
+}
+
+// How the first difference is resolved, indexed by state + class of the
+// left character, then by the class of the right character.
+inline constexpr signed char natural_cmp = 2;
+inline constexpr signed char natural_len = 3;
+
+// Columns are other/digit/zero on the right; "cmp" means the characters
+// decide and "len" means the longer digit run is the larger.
+inline constexpr signed char natural_result[12][3] = {
+    // normal: left other, digit, zero
+    {natural_cmp, natural_cmp, natural_cmp},
+    {natural_cmp, natural_len, natural_cmp},
+    {natural_cmp, natural_cmp, natural_cmp},
+    // integral
+    {natural_cmp, -1, -1},
+    {+1, natural_len, natural_len},
+    {+1, natural_len, natural_len},
+    // fractional
+    {natural_cmp, natural_cmp, natural_cmp},
+    {natural_cmp, natural_cmp, natural_cmp},
+    {natural_cmp, natural_cmp, natural_cmp},
+    // zeros
+    {natural_cmp, +1, +1},
+    {-1, natural_cmp, natural_cmp},
+    {-1, natural_cmp, natural_cmp},
+};
+
+[[nodiscard]] inline unsigned count_trailing_zeros32(unsigned mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+// Returns the first index at which a and b differ or both end.  For byte
+// strings, 16 bytes are compared at a time whenever neither load can cross
+// a page boundary, so reading past a terminator never faults.  Near a
+// boundary the loop steps one character at a time until it is passed.
+template <typename Char>
+[[nodiscard]] inline std::size_t common_prefix_length(const Char* a, const Char* b) noexcept
+{
+    std::size_t i = 0;
+    for (;;)
+    {
+#ifdef CINTER_NATURAL_COMPARE_SSE2
+        if constexpr (sizeof(Char) == 1)
+        {
+            constexpr std::uintptr_t page_mask = 4095;
+            while ((reinterpret_cast<std::uintptr_t>(a + i) & page_mask) <= page_mask + 1 - 16
+                   && (reinterpret_cast<std::uintptr_t>(b + i) & page_mask) <= page_mask + 1 - 16)
+            {
+                const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+                const unsigned equal = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+                const unsigned ended
+                    = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, _mm_setzero_si128())));
+                const unsigned stop = (~equal & 0xffffu) | ended;
+                if (stop)
+                {
+                    return i + count_trailing_zeros32(stop);
+                }
+                i += 16;
+            }
+        }
+#endif
+        for (std::size_t step = 0; step < 16; ++step, ++i)
+        {
+            if (a[i] != b[i] || a[i] == Char{})
+            {
+                return i;
+            }
+        }
+    }
+}
+
+template <typename Char>
+[[nodiscard]] constexpr int compare_chars(Char a, Char b) noexcept
+{
+    return std::char_traits<Char>::lt(a, b) ? -1 : (std::char_traits<Char>::lt(b, a) ? 1 : 0);
+}
+
+} // namespace detail
+
+// compare_natural orders strings the way glibc strverscmp() does, so digit
+// runs compare by numeric value ("file2" < "file10", "linux-5.9" <
+// "linux-5.15") and runs with leading zeros sort as fractional parts
+// ("1.01" < "1.1").  It returns a negative value, zero or a positive value.
+// The common prefix is skipped with SSE2 where available; only the digits
+// just before and just after the first difference are then examined, each
+// once.  Null strings compare as empty.  Unlike strverscmp() it works for
+// every character type and does not depend on the locale.
+template <typename Char>
+[[nodiscard]] inline int compare_natural(basic_safe_string<Char> lhs, basic_safe_string<Char> rhs) noexcept
+{
+    const Char* a = lhs.c_str();
+    const Char* b = rhs.c_str();
+    if (a == b)
+    {
+        return 0;
+    }
+    const std::size_t i = detail::common_prefix_length(a, b);
+    const Char        c1 = a[i];
+    const Char        c2 = b[i];
+    if (c1 == c2)
+    {
+        return 0;
+    }
+
+    // Recover the state from the digit run, if any, that ends at i.
+    std::size_t start = i;
+    while (start > 0 && detail::is_ascii_digit(a[start - 1]))
+    {
+        --start;
+    }
+    unsigned state = detail::natural_normal;
+    if (start < i)
+    {
+        state = detail::natural_integral;
+        if (a[start] == Char('0'))
+        {
+            state = detail::natural_zeros;
+            for (std::size_t k = start; k < i; ++k)
+            {
+                if (a[k] != Char('0'))
+                {
+                    state = detail::natural_fractional;
+                    break;
+                }
+            }
+        }
+    }
+
+    const signed char result
+        = detail::natural_result[state + detail::natural_class_of(c1)][detail::natural_class_of(c2)];
+    const int diff = detail::compare_chars(c1, c2);
+    if (result == detail::natural_cmp)
+    {
+        return diff;
+    }
+    if (result != detail::natural_len)
+    {
+        return result;
+    }
+    // Both runs are integral: the longer one is the larger number.
+    for (std::size_t k = i + 1;; ++k)
+    {
+        const bool d1 = detail::is_ascii_digit(a[k]);
+        const bool d2 = detail::is_ascii_digit(b[k]);
+        if (d1 != d2)
+        {
+            return d1 ? 1 : -1;
+        }
+        if (!d1)
+        {
+            return diff;
+        }
+    }
+}
+
+// Comparator for sorted containers and algorithms, e.g.
+// std::set<cinter::safe_string, cinter::natural_less>.
+struct natural_less
+{
+    [[nodiscard]] bool operator()(safe_string lhs, safe_string rhs) const noexcept
+    {
+        return compare_natural(lhs, rhs) < 0;
+    }
+
+    [[nodiscard]] bool operator()(safe_wstring lhs, safe_wstring rhs) const noexcept
+    {
+        return compare_natural(lhs, rhs) < 0;
+    }
+
+    template <typename Char>
+    [[nodiscard]] bool operator()(basic_safe_string<Char> lhs, basic_safe_string<Char> rhs) const noexcept
+    {
+        return compare_natural(lhs, rhs) < 0;
+    }
+
+    template <typename Char, typename Traits, typename Allocator>
+    [[nodiscard]] bool operator()(const std::basic_string<Char, Traits, Allocator>& lhs,
+                                  const std::basic_string<Char, Traits, Allocator>& rhs) const noexcept
+    {
+        return compare_natural(basic_safe_string<Char>(lhs.c_str()), basic_safe_string<Char>(rhs.c_str())) < 0;
+    }
+};
+
+} // namespace cinter
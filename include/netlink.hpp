@@ -0,0 +1,317 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "bounded_safe_string.hpp"
+#include "linux_records.hpp"
+#include "record_range.hpp"
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+
+// Zero-copy netlink support.  Requests are built into a reusable buffer and
+// replies are parsed in place: messages, attributes and string attributes
+// are views into the receive buffer.  This header is only usable on Linux.
+
+namespace cinter
+{
+
+struct rtattr_policy
+{
+    static constexpr std::size_t alignment = RTA_ALIGNTO;
+    static std::size_t record_length(const rtattr& a) noexcept { return a.rta_len; }
+};
+
+struct nlattr_policy
+{
+    static constexpr std::size_t alignment = NLA_ALIGNTO;
+    static std::size_t record_length(const nlattr& a) noexcept { return a.nla_len; }
+};
+
+using rtattr_range = record_range<rtattr, rtattr_policy>;
+using nlattr_range = record_range<nlattr, nlattr_policy>;
+
+// Zero on success (including acknowledgements) or a positive errno value.
+using netlink_status = sentinel_result<int>;
+
+// Returns the status carried by an NLMSG_ERROR message; any other message
+// type is a success.
+[[nodiscard]] inline netlink_status netlink_error(const nlmsghdr& h) noexcept
+{
+    if (h.nlmsg_type != NLMSG_ERROR)
+    {
+        return 0;
+    }
+    if (h.nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr)))
+    {
+        return EBADMSG;
+    }
+    nlmsgerr err;
+    std::memcpy(&err, NLMSG_DATA(&h), sizeof(err));
+    return -err.error;
+}
+
+[[nodiscard]] inline bool is_done(const nlmsghdr& h) noexcept
+{
+    return h.nlmsg_type == NLMSG_DONE;
+}
+
+// Returns the family header (ifinfomsg, rtmsg, ndmsg, ...) of a message, or
+// nullptr if the message is too short to hold one.
+template <typename FamilyHeader>
+[[nodiscard]] const FamilyHeader* family_header(const nlmsghdr& h) noexcept
+{
+    if (h.nlmsg_len < NLMSG_LENGTH(sizeof(FamilyHeader)))
+    {
+        return nullptr;
+    }
+    return static_cast<const FamilyHeader*>(NLMSG_DATA(&h));
+}
+
+// Attributes following the family header of a message.
+template <typename FamilyHeader>
+[[nodiscard]] rtattr_range attributes(const nlmsghdr& h) noexcept
+{
+    const std::size_t offset = NLMSG_LENGTH(NLMSG_ALIGN(sizeof(FamilyHeader)));
+    if (h.nlmsg_len < offset)
+    {
+        return rtattr_range();
+    }
+    const unsigned char* base = reinterpret_cast<const unsigned char*>(&h);
+    return rtattr_range(base + offset, h.nlmsg_len - offset);
+}
+
+// Attributes nested inside an attribute.
+[[nodiscard]] inline rtattr_range nested_attributes(const rtattr& a) noexcept
+{
+    return rtattr_range(RTA_DATA(&a), RTA_PAYLOAD(&a));
+}
+
+// String attributes such as IFLA_IFNAME are null terminated in practice, but
+// the terminator is only guaranteed to be within the attribute payload.
+[[nodiscard]] inline bounded_safe_string attribute_string(const rtattr& a) noexcept
+{
+    return bounded_safe_string(static_cast<const char*>(RTA_DATA(&a)), RTA_PAYLOAD(&a));
+}
+
+// Copies a fixed-size attribute value into out.  Returns false, leaving out
+// untouched, if the payload is too short.
+template <typename T>
+[[nodiscard]] bool read_attribute(const rtattr& a, T& out) noexcept
+{
+    if (RTA_PAYLOAD(&a) < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&out, RTA_DATA(&a), sizeof(T));
+    return true;
+}
+
+// Builds netlink requests into a buffer that is reused from one request to
+// the next, so steady-state polling does not allocate.  Offsets rather than
+// pointers are kept because appending may grow the buffer.
+class netlink_request_builder
+{
+    std::vector<unsigned char> buffer_;
+    std::size_t                message_ = 0;
+    std::uint32_t              next_seq_ = 1;
+
+    [[nodiscard]] nlmsghdr& message() noexcept { return *reinterpret_cast<nlmsghdr*>(buffer_.data() + message_); }
+
+    [[nodiscard]] std::size_t append(const void* data, std::size_t size, std::size_t alignment)
+    {
+        const std::size_t offset = buffer_.size();
+        const std::size_t padded = (size + alignment - 1) / alignment * alignment;
+        buffer_.resize(offset + padded);
+        if (size)
+        {
+            std::memcpy(buffer_.data() + offset, data, size);
+        }
+        std::memset(buffer_.data() + offset + size, 0, padded - size);
+        message().nlmsg_len = static_cast<std::uint32_t>(buffer_.size() - message_);
+        return offset;
+    }
+
+public:
+    netlink_request_builder() = default;
+    explicit netlink_request_builder(std::size_t capacity) { buffer_.reserve(capacity); }
+
+    // Discards all messages but keeps the buffer capacity.
+    void clear() noexcept
+    {
+        buffer_.clear();
+        message_ = 0;
+    }
+
+    // Starts a new message in the buffer and returns its sequence number.
+    std::uint32_t begin(std::uint16_t type, std::uint16_t flags)
+    {
+        message_ = buffer_.size();
+        buffer_.resize(message_ + NLMSG_HDRLEN);
+        nlmsghdr& h   = message();
+        h.nlmsg_len   = NLMSG_HDRLEN;
+        h.nlmsg_type  = type;
+        h.nlmsg_flags = flags;
+        h.nlmsg_seq   = next_seq_++;
+        h.nlmsg_pid   = 0;
+        return h.nlmsg_seq;
+    }
+
+    // Appends the family header (rtgenmsg, ifinfomsg, rtmsg, ...) of the
+    // current message.
+    template <typename FamilyHeader>
+    void add_header(const FamilyHeader& header)
+    {
+        (void)append(&header, sizeof(header), NLMSG_ALIGNTO);
+    }
+
+    void add_attribute(std::uint16_t type, const void* data, std::size_t size)
+    {
+        rtattr a;
+        a.rta_type = type;
+        a.rta_len  = static_cast<unsigned short>(RTA_LENGTH(size));
+        (void)append(&a, sizeof(a), RTA_ALIGNTO);
+        (void)append(data, size, RTA_ALIGNTO);
+    }
+
+    // String attributes are sent with their terminator.
+    void add_attribute(std::uint16_t type, safe_string value)
+    {
+        const std::string_view v = value.view();
+        add_attribute(type, v.data(), v.size() + 1);
+    }
+
+    template <typename T>
+    void add_attribute_value(std::uint16_t type, const T& value)
+    {
+        add_attribute(type, &value, sizeof(value));
+    }
+
+    // Starts a nested attribute; pass the result to end_nested().
+    [[nodiscard]] std::size_t begin_nested(std::uint16_t type)
+    {
+        rtattr a;
+        a.rta_type = type;
+        a.rta_len  = 0;
+        return append(&a, sizeof(a), RTA_ALIGNTO);
+    }
+
+    void end_nested(std::size_t nested) noexcept
+    {
+        reinterpret_cast<rtattr*>(buffer_.data() + nested)->rta_len
+            = static_cast<unsigned short>(buffer_.size() - nested);
+    }
+
+    [[nodiscard]] const unsigned char* data() const noexcept { return buffer_.data(); }
+    [[nodiscard]] std::size_t size() const noexcept { return buffer_.size(); }
+};
+
+// RAII owner of a netlink socket.
+class netlink_socket
+{
+    int fd_ = -1;
+
+public:
+    using io_result = sentinel_result<ssize_t, -1, not_equal_to<ssize_t>>;
+
+    netlink_socket() noexcept = default;
+
+    // Opens a socket for the given protocol (NETLINK_ROUTE, ...).  Check
+    // is_open() and errno for failures.
+    explicit netlink_socket(int protocol) noexcept : fd_(::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, protocol))
+    {}
+
+    netlink_socket(netlink_socket&& other) noexcept : fd_(other.fd_)
+    {
+        other.fd_ = -1;
+    }
+
+    netlink_socket& operator=(netlink_socket&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            fd_       = other.fd_;
+            other.fd_ = -1;
+        }
+        return *this;
+    }
+
+    netlink_socket(const netlink_socket& other) = delete;
+    netlink_socket& operator=(const netlink_socket& other) = delete;
+
+    ~netlink_socket() noexcept
+    {
+        close();
+    }
+
+    void close() noexcept
+    {
+        if (fd_ != -1)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return fd_ != -1; }
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+    // Sends every message in the builder to the kernel.
+    io_result send(const netlink_request_builder& request) const noexcept
+    {
+        sockaddr_nl kernel{};
+        kernel.nl_family = AF_NETLINK;
+        return ::sendto(fd_,
+                        request.data(),
+                        request.size(),
+                        0,
+                        reinterpret_cast<const sockaddr*>(&kernel),
+                        sizeof(kernel));
+    }
+
+    // Receives one datagram.  Dumps arrive as several datagrams, each holding
+    // many messages; parse them with nlmsghdr_range(buffer, result.value()).
+    // The buffer should be aligned for nlmsghdr and at least 32 KiB.
+    io_result receive(void* buffer, std::size_t size) const noexcept
+    {
+        return ::recv(fd_, buffer, size, 0);
+    }
+};
+
+} // namespace cinter
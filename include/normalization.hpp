@@ -0,0 +1,578 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "codec.hpp"
+#include "safe_string.hpp"
+#include "unicode_tables.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CINTER_NORMALIZATION_SSE2 1
+#endif
+#if defined(__SANITIZE_ADDRESS__)
+#undef CINTER_NORMALIZATION_SSE2
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#undef CINTER_NORMALIZATION_SSE2
+#endif
+#endif
+
+namespace cinter
+{
+
+/*
+Unicode normalization (UAX #15) of UTF-8 C-strings into NFC or NFD,
+without ICU.  The character data lives in unicode_tables.hpp, generated
+by tools/gen_unicode_tables.py; detail::unicode::version names the Unicode
+version.
+
+Most strings are already normalized, so every function starts with the
+quick check: ASCII is skipped 16 bytes at a time with SSE2, and other
+characters cost one two-stage table lookup.  Only when the quick check
+fails is the rest of the string, from the last character known to be
+unaffected, decomposed, reordered and (for NFC) recomposed.
+
+    char buffer[PATH_MAX];
+    auto r = cinter::normalize(name, buffer, sizeof(buffer));   // NFC
+    if (r.is_ok()) { lookup(buffer); }
+
+    if (cinter::quick_check(name) == cinter::quick_check_result::yes) { ... }
+
+Input must be well-formed UTF-8; malformed input is reported as
+codec_error::invalid_character.  Works with safe_string and, in C++20,
+safe_u8string.
+*/
+
+enum class normalization_form
+{
+    nfc,
+    nfd
+};
+
+enum class quick_check_result
+{
+    yes,     // normalized
+    no,      // not normalized, or not valid UTF-8
+    maybe    // only normalizing can tell
+};
+
+namespace detail
+{
+
+[[nodiscard]] inline std::uint16_t unicode_properties(char32_t cp) noexcept
+{
+    using namespace unicode;
+    constexpr char32_t block_mask = (char32_t{1} << block_bits) - 1;
+    return property_values[property_stage2[(std::size_t{property_stage1[cp >> block_bits]} << block_bits)
+                                           | (cp & block_mask)]];
+}
+
+[[nodiscard]] constexpr unsigned combining_class(std::uint16_t properties) noexcept
+{
+    return properties & 0xff;
+}
+
+[[nodiscard]] constexpr std::uint16_t quick_check_no(normalization_form form) noexcept
+{
+    return form == normalization_form::nfc ? unicode::nfc_no : unicode::nfd_no;
+}
+
+[[nodiscard]] constexpr std::uint16_t quick_check_not_yes(normalization_form form) noexcept
+{
+    return form == normalization_form::nfc ? unicode::nfc_no | unicode::nfc_maybe : unicode::nfd_no;
+}
+
+// A starter whose quick check value is yes: normalization never moves or
+// merges anything across the position before it.
+[[nodiscard]] constexpr bool is_boundary(std::uint16_t properties, normalization_form form) noexcept
+{
+    return (properties & (0xff | quick_check_not_yes(form))) == 0;
+}
+
+// Decodes one well-formed UTF-8 sequence.  Returns its length, or 0 for
+// malformed input (including the terminator).
+[[nodiscard]] inline unsigned decode_utf8(const unsigned char* p, char32_t& cp) noexcept
+{
+    const unsigned c = p[0];
+    if (c < 0x80)
+    {
+        cp = c;
+        return c != 0;
+    }
+    if (c < 0xc2)
+    {
+        return 0;
+    }
+    if (c < 0xe0)
+    {
+        if ((p[1] & 0xc0) != 0x80)
+        {
+            return 0;
+        }
+        cp = ((c & 0x1f) << 6) | (p[1] & 0x3f);
+        return 2;
+    }
+    if (c < 0xf0)
+    {
+        if ((p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80)
+        {
+            return 0;
+        }
+        cp = ((c & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+        return cp >= 0x800 && (cp < 0xd800 || cp > 0xdfff) ? 3 : 0;
+    }
+    if (c < 0xf5)
+    {
+        if ((p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80 || (p[3] & 0xc0) != 0x80)
+        {
+            return 0;
+        }
+        cp = ((c & 0x07) << 18) | ((p[1] & 0x3f) << 12) | ((p[2] & 0x3f) << 6) | (p[3] & 0x3f);
+        return cp >= 0x10000 && cp <= 0x10ffff ? 4 : 0;
+    }
+    return 0;
+}
+
+[[nodiscard]] inline unsigned encode_utf8(char32_t cp, unsigned char* out) noexcept
+{
+    if (cp < 0x80)
+    {
+        out[0] = static_cast<unsigned char>(cp);
+        return 1;
+    }
+    if (cp < 0x800)
+    {
+        out[0] = static_cast<unsigned char>(0xc0 | (cp >> 6));
+        out[1] = static_cast<unsigned char>(0x80 | (cp & 0x3f));
+        return 2;
+    }
+    if (cp < 0x10000)
+    {
+        out[0] = static_cast<unsigned char>(0xe0 | (cp >> 12));
+        out[1] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3f));
+        out[2] = static_cast<unsigned char>(0x80 | (cp & 0x3f));
+        return 3;
+    }
+    out[0] = static_cast<unsigned char>(0xf0 | (cp >> 18));
+    out[1] = static_cast<unsigned char>(0x80 | ((cp >> 12) & 0x3f));
+    out[2] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3f));
+    out[3] = static_cast<unsigned char>(0x80 | (cp & 0x3f));
+    return 4;
+}
+
+// Hangul syllables decompose and compose arithmetically (Unicode 3.12).
+inline constexpr char32_t hangul_s_base  = 0xac00;
+inline constexpr char32_t hangul_l_base  = 0x1100;
+inline constexpr char32_t hangul_v_base  = 0x1161;
+inline constexpr char32_t hangul_t_base  = 0x11a7;
+inline constexpr char32_t hangul_l_count = 19;
+inline constexpr char32_t hangul_v_count = 21;
+inline constexpr char32_t hangul_t_count = 28;
+inline constexpr char32_t hangul_n_count = hangul_v_count * hangul_t_count;
+inline constexpr char32_t hangul_s_count = hangul_l_count * hangul_n_count;
+
+inline constexpr char32_t no_composite = 0;
+
+[[nodiscard]] inline char32_t compose_pair(char32_t first, char32_t second) noexcept
+{
+    if (first - hangul_l_base < hangul_l_count && second - hangul_v_base < hangul_v_count)
+    {
+        return hangul_s_base + ((first - hangul_l_base) * hangul_v_count + (second - hangul_v_base)) * hangul_t_count;
+    }
+    if (first - hangul_s_base < hangul_s_count && (first - hangul_s_base) % hangul_t_count == 0
+        && second - hangul_t_base - 1 < hangul_t_count - 1)
+    {
+        return first + (second - hangul_t_base);
+    }
+    const std::uint64_t key   = (std::uint64_t{first} << 21) | second;
+    const auto*         begin = std::begin(unicode::compositions);
+    const auto*         end   = std::end(unicode::compositions);
+    const auto* it = std::lower_bound(begin, end, key, [](const unicode::composition_entry& e, std::uint64_t k) {
+        return e.pair < k;
+    });
+    return it != end && it->pair == key ? it->composite : no_composite;
+}
+
+// Code points of one segment.  Segments are almost always a handful of
+// code points; pathological runs of combining marks spill to the heap.
+class code_point_buffer
+{
+    char32_t              inline_[32];
+    std::vector<char32_t> heap_;
+    char32_t*             data_     = inline_;
+    std::size_t           size_     = 0;
+    std::size_t           capacity_ = 32;
+
+public:
+    code_point_buffer() = default;
+    code_point_buffer(const code_point_buffer& other) = delete;
+    code_point_buffer& operator=(const code_point_buffer& other) = delete;
+
+    void push_back(char32_t cp)
+    {
+        if (size_ == capacity_)
+        {
+            if (data_ == inline_)
+            {
+                heap_.assign(inline_, inline_ + size_);
+            }
+            heap_.resize(capacity_ * 2);
+            data_     = heap_.data();
+            capacity_ = heap_.size();
+        }
+        data_[size_++] = cp;
+    }
+
+    void resize(std::size_t size) noexcept { size_ = size; }
+    void clear() noexcept { size_ = 0; }
+
+    [[nodiscard]] char32_t*   data() noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+};
+
+inline void decompose(char32_t cp, std::uint16_t properties, code_point_buffer& out)
+{
+    if ((properties & unicode::nfd_no) == 0)
+    {
+        out.push_back(cp);
+        return;
+    }
+    if (cp - hangul_s_base < hangul_s_count)
+    {
+        const char32_t index = cp - hangul_s_base;
+        out.push_back(hangul_l_base + index / hangul_n_count);
+        out.push_back(hangul_v_base + index % hangul_n_count / hangul_t_count);
+        if (index % hangul_t_count != 0)
+        {
+            out.push_back(hangul_t_base + index % hangul_t_count);
+        }
+        return;
+    }
+    const auto* begin = std::begin(unicode::decompositions);
+    const auto* end   = std::end(unicode::decompositions);
+    const auto* it    = std::lower_bound(begin, end, cp, [](const unicode::decomposition_entry& e, char32_t c) {
+        return e.code_point < c;
+    });
+    if (it == end || it->code_point != cp)
+    {
+        out.push_back(cp);
+        return;
+    }
+    for (unsigned i = 0; i < it->length; ++i)
+    {
+        out.push_back(unicode::decomposition_pool[it->offset + i]);
+    }
+}
+
+// Stable sort of each run of non-starters by combining class, then (for
+// NFC) canonical composition, in place.
+inline void reorder_and_compose(code_point_buffer& segment, normalization_form form) noexcept
+{
+    char32_t* const   cps = segment.data();
+    const std::size_t n   = segment.size();
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        const char32_t cp  = cps[i];
+        const unsigned ccc = combining_class(unicode_properties(cp));
+        if (ccc == 0)
+        {
+            continue;
+        }
+        std::size_t j = i;
+        while (j > 0)
+        {
+            const unsigned before = combining_class(unicode_properties(cps[j - 1]));
+            if (before <= ccc)
+            {
+                break;
+            }
+            cps[j] = cps[j - 1];
+            --j;
+        }
+        cps[j] = cp;
+    }
+    if (form == normalization_form::nfd || n == 0)
+    {
+        return;
+    }
+    std::size_t starter    = 0;
+    unsigned    last_class = combining_class(unicode_properties(cps[0])) == 0 ? 0 : 256;
+    std::size_t kept       = 1;
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        const char32_t      cp         = cps[i];
+        const std::uint16_t properties = unicode_properties(cp);
+        const unsigned      ccc        = combining_class(properties);
+        // Only characters with an NFC quick check value of "maybe" are
+        // ever the second half of a composition.
+        const char32_t composite = last_class == 256 || (properties & unicode::nfc_maybe) == 0
+                                       ? no_composite
+                                       : compose_pair(cps[starter], cp);
+        if (composite != no_composite && (last_class < ccc || last_class == 0))
+        {
+            cps[starter] = composite;
+            continue;
+        }
+        if (ccc == 0)
+        {
+            starter = kept;
+        }
+        last_class   = ccc;
+        cps[kept++] = cp;
+    }
+    segment.resize(kept);
+}
+
+// Result of the quick check: the verdict, the offset of the last boundary
+// before the first character that is not "yes", and, for a "yes", the
+// length of the string.
+struct quick_check_scan
+{
+    quick_check_result result;
+    std::size_t        stable;
+    std::size_t        length;
+};
+
+[[nodiscard]] inline quick_check_scan scan_normalization(const unsigned char* s, normalization_form form) noexcept
+{
+    const std::uint16_t not_yes = quick_check_not_yes(form);
+    const std::uint16_t no      = quick_check_no(form);
+    std::size_t         i       = 0;
+    std::size_t         stable  = 0;
+    quick_check_result  result  = quick_check_result::yes;
+    unsigned            last_class = 0;
+    for (;;)
+    {
+#ifdef CINTER_NORMALIZATION_SSE2
+        if (result == quick_check_result::yes)
+        {
+            while ((reinterpret_cast<std::uintptr_t>(s + i) & 4095) <= 4096 - 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+                const int     stop  = _mm_movemask_epi8(block)
+                                 | _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128()));
+                if (stop != 0)
+                {
+                    break;
+                }
+                i += 16;
+                stable     = i - 1;
+                last_class = 0;
+            }
+        }
+#endif
+        char32_t       cp;
+        const unsigned length = decode_utf8(s + i, cp);
+        if (length == 0)
+        {
+            if (s[i] == 0)
+            {
+                return {result, stable, i};
+            }
+            return {quick_check_result::no, stable, 0};
+        }
+        const std::uint16_t properties = cp < 0x80 ? 0 : unicode_properties(cp);
+        const unsigned      ccc        = combining_class(properties);
+        if ((ccc != 0 && last_class > ccc) || (properties & no) != 0)
+        {
+            return {quick_check_result::no, stable, 0};
+        }
+        if ((properties & not_yes) != 0)
+        {
+            result = quick_check_result::maybe;
+        }
+        else if (ccc == 0 && result == quick_check_result::yes)
+        {
+            stable = i;
+        }
+        last_class = ccc;
+        i += length;
+    }
+}
+
+// Normalizes the string at s from its start, which must be a boundary or
+// the start of the whole string, passing each code point to emit.  Returns
+// false for malformed UTF-8 or when emit returns false.
+template <typename Emit>
+[[nodiscard]] bool normalize_code_points(const unsigned char* s, normalization_form form, Emit&& emit)
+{
+    code_point_buffer segment;
+    auto              flush = [&] {
+        reorder_and_compose(segment, form);
+        for (std::size_t k = 0; k < segment.size(); ++k)
+        {
+            if (!emit(segment.data()[k]))
+            {
+                return false;
+            }
+        }
+        segment.clear();
+        return true;
+    };
+    for (;;)
+    {
+        char32_t       cp;
+        const unsigned length = decode_utf8(s, cp);
+        if (length == 0)
+        {
+            return *s == 0 && flush();
+        }
+        s += length;
+        const std::uint16_t properties = cp < 0x80 ? 0 : unicode_properties(cp);
+        if (segment.size() != 0 && is_boundary(properties, form) && !flush())
+        {
+            return false;
+        }
+        decompose(cp, properties, segment);
+    }
+}
+
+} // namespace detail
+
+// Checks whether s is in the given form without normalizing it.
+template <typename Char>
+[[nodiscard]] quick_check_result quick_check(basic_safe_string<Char>   s,
+                                             normalization_form form = normalization_form::nfc) noexcept
+{
+    static_assert(sizeof(Char) == 1, "normalization works on UTF-8 strings");
+    return detail::scan_normalization(reinterpret_cast<const unsigned char*>(s.c_str()), form).result;
+}
+
+// Like quick_check(), but resolves "maybe" by normalizing the rest of the
+// string and comparing as it goes.  Never allocates for ordinary input.
+template <typename Char>
+[[nodiscard]] bool is_normalized(basic_safe_string<Char> s, normalization_form form = normalization_form::nfc)
+{
+    static_assert(sizeof(Char) == 1, "normalization works on UTF-8 strings");
+    const auto* p    = reinterpret_cast<const unsigned char*>(s.c_str());
+    const auto  scan = detail::scan_normalization(p, form);
+    if (scan.result != quick_check_result::maybe)
+    {
+        return scan.result == quick_check_result::yes;
+    }
+    const unsigned char* expected = p + scan.stable;
+    const bool           same     = detail::normalize_code_points(expected, form, [&](char32_t cp) {
+        unsigned char  bytes[4];
+        const unsigned length = detail::encode_utf8(cp, bytes);
+        for (unsigned k = 0; k < length; ++k, ++expected)
+        {
+            if (*expected != bytes[k])
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+    return same && *expected == 0;
+}
+
+// Writes s in the given form to out[0 .. capacity), null terminated, and
+// returns its length.  A string that passes the quick check is copied.
+template <typename Char>
+codec_result normalize(basic_safe_string<Char> s, Char* out, std::size_t capacity,
+                       normalization_form form = normalization_form::nfc)
+{
+    static_assert(sizeof(Char) == 1, "normalization works on UTF-8 strings");
+    const auto* p    = reinterpret_cast<const unsigned char*>(s.c_str());
+    const auto  scan = detail::scan_normalization(p, form);
+    if (scan.result == quick_check_result::yes)
+    {
+        if (scan.length >= capacity)
+        {
+            return codec_error::buffer_too_small;
+        }
+        std::memcpy(out, p, scan.length + 1);
+        return static_cast<std::ptrdiff_t>(scan.length);
+    }
+    if (capacity == 0 || scan.stable >= capacity)
+    {
+        return codec_error::buffer_too_small;
+    }
+    std::memcpy(out, p, scan.stable);
+    auto* const    first = reinterpret_cast<unsigned char*>(out);
+    unsigned char* o     = first + scan.stable;
+    auto* const    end   = first + capacity - 1;   // room for the terminator
+    bool           full  = false;
+    const bool     ok    = detail::normalize_code_points(p + scan.stable, form, [&](char32_t cp) {
+        unsigned char  bytes[4];
+        const unsigned length = detail::encode_utf8(cp, bytes);
+        if (static_cast<std::size_t>(end - o) < length)
+        {
+            full = true;
+            return false;
+        }
+        std::memcpy(o, bytes, length);
+        o += length;
+        return true;
+    });
+    if (!ok)
+    {
+        return full ? codec_error::buffer_too_small : codec_error::invalid_character;
+    }
+    *o = 0;
+    return o - first;
+}
+
+// Appends s in the given form to out.
+template <typename Char>
+codec_result normalize(basic_safe_string<Char> s, std::basic_string<Char>& out,
+                       normalization_form form = normalization_form::nfc)
+{
+    static_assert(sizeof(Char) == 1, "normalization works on UTF-8 strings");
+    const auto* p    = reinterpret_cast<const unsigned char*>(s.c_str());
+    const auto  scan = detail::scan_normalization(p, form);
+    if (scan.result == quick_check_result::yes)
+    {
+        out.append(s.c_str(), scan.length);
+        return static_cast<std::ptrdiff_t>(scan.length);
+    }
+    const std::size_t old = out.size();
+    out.append(s.c_str(), scan.stable);
+    const bool ok = detail::normalize_code_points(p + scan.stable, form, [&](char32_t cp) {
+        unsigned char  bytes[4];
+        const unsigned length = detail::encode_utf8(cp, bytes);
+        out.append(reinterpret_cast<const Char*>(bytes), length);
+        return true;
+    });
+    if (!ok)
+    {
+        out.resize(old);
+        return codec_error::invalid_character;
+    }
+    return static_cast<std::ptrdiff_t>(out.size() - old);
+}
+
+} // namespace cinter
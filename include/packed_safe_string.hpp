@@ -0,0 +1,348 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#ifdef __cpp_impl_three_way_comparison
+#include <compare>
+#endif
+
+// Set to 0 to store a plain pointer and compute the length every time it is
+// needed.  Tagging is enabled on 64-bit x86 and AArch64, where user-space
+// addresses fit in the low 48 bits, except where the top byte may already
+// carry a tag: Android, memory tagging (MTE) and HWASan.
+#ifndef CINTER_PACKED_SAFE_STRING_TAGGED
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)) && UINTPTR_MAX == 0xFFFFFFFFFFFFFFFFu \
+    && !defined(__ANDROID__) && !defined(__ARM_FEATURE_MEMORY_TAGGING) && !defined(__SANITIZE_HWADDRESS__)
+#define CINTER_PACKED_SAFE_STRING_TAGGED 1
+#else
+#define CINTER_PACKED_SAFE_STRING_TAGGED 0
+#endif
+#if defined(__has_feature)
+#if __has_feature(hwaddress_sanitizer)
+#undef CINTER_PACKED_SAFE_STRING_TAGGED
+#define CINTER_PACKED_SAFE_STRING_TAGGED 0
+#endif
+#endif
+#endif
+
+namespace cinter
+{
+
+/*
+basic_packed_safe_string is a basic_safe_string, still the size of one
+pointer, that remembers its length once something has asked for it.
+Lengths up to max_cached_length are kept in the upper 16 bits of the
+pointer; longer strings are scanned each time, as are all strings when
+CINTER_PACKED_SAFE_STRING_TAGGED is 0.  view(), length(), sized() and the
+comparison operators use the cached length, so sorting or searching a large
+array of C strings pays for each strlen once instead of once per comparison.
+
+The length is computed lazily from const member functions.  The cache is
+an atomic word updated with compare-and-swap, so concurrent readers of one
+object are safe.  As with std::string_view, the characters must not change
+while they are wrapped.
+
+    std::vector<cinter::packed_safe_string> names(raw_names.begin(), raw_names.end());
+    std::sort(names.begin(), names.end());
+    auto it = std::lower_bound(names.begin(), names.end(), cinter::packed_safe_string("wlan0"));
+*/
+template <typename Char = char>
+class basic_packed_safe_string
+{
+public:
+    static constexpr bool tagged = CINTER_PACKED_SAFE_STRING_TAGGED != 0;
+    static constexpr std::size_t max_cached_length = tagged ? 65534 : 0;
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static constexpr unsigned tag_shift = 48;
+    static constexpr std::uintptr_t pointer_mask = tagged ? (std::uintptr_t{1} << tag_shift) - 1 : ~std::uintptr_t{0};
+
+    // Pointer in the low 48 bits; the upper 16 bits hold length + 1, or 0
+    // while the length is unknown or too long to cache.
+    mutable std::atomic<std::uintptr_t> bits;
+
+    // src without the upper 16 bits, which would otherwise be read back as
+    // a length.  They are clear in user-space pointers on the platforms
+    // where tagging is enabled.
+    [[nodiscard]] static std::uintptr_t address(const Char* src) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(src) & pointer_mask;
+    }
+
+    [[nodiscard]] static std::uintptr_t pack(const Char* src, std::size_t length) noexcept
+    {
+        std::uintptr_t p = address(src);
+        if constexpr (tagged)
+        {
+            if (src && length <= max_cached_length)
+            {
+                p |= static_cast<std::uintptr_t>(length + 1) << tag_shift;
+            }
+        }
+        return p;
+    }
+
+    [[nodiscard]] const Char* pointer() const noexcept
+    {
+        return reinterpret_cast<const Char*>(bits.load(std::memory_order_relaxed) & pointer_mask);
+    }
+
+    // Cached length, or npos if unknown.
+    [[nodiscard]] std::size_t cached_length() const noexcept
+    {
+        if constexpr (tagged)
+        {
+            std::uintptr_t tag = bits.load(std::memory_order_relaxed) >> tag_shift;
+            return tag ? static_cast<std::size_t>(tag - 1) : npos;
+        }
+        else
+        {
+            return npos;
+        }
+    }
+
+public:
+    basic_packed_safe_string() noexcept : bits(0) {}
+    // Implicit conversion is desired
+    basic_packed_safe_string(const Char* src) noexcept : bits(address(src)) {}
+    basic_packed_safe_string(basic_safe_string<Char> src) noexcept
+        : bits(src.is_null() ? 0 : address(src.c_str()))
+    {}
+    // Wraps src whose length is already known, e.g. from the C API that
+    // returned it.
+    basic_packed_safe_string(const Char* src, std::size_t length) noexcept : bits(pack(src, length)) {}
+
+    basic_packed_safe_string(const basic_packed_safe_string& other) noexcept
+        : bits(other.bits.load(std::memory_order_relaxed))
+    {}
+
+    ~basic_packed_safe_string() noexcept = default;
+
+    basic_packed_safe_string& operator=(const basic_packed_safe_string& other) noexcept
+    {
+        bits.store(other.bits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    [[nodiscard]] bool is_null() const noexcept {return pointer() == nullptr;}
+    [[nodiscard]] explicit operator bool() const noexcept {return pointer() != nullptr;}
+    [[nodiscard]] basic_safe_string<Char> safe() const noexcept {return pointer();}
+    // Implicit conversion is desired so packed strings can be passed to the
+    // functions taking basic_safe_string.
+    operator basic_safe_string<Char>() const noexcept {return safe();}
+    [[nodiscard]] const Char* c_str() const noexcept {return safe().c_str();}
+
+    // Number of characters before the terminator, computed on first use and
+    // then cached if it is at most max_cached_length.
+    [[nodiscard]] std::size_t length() const noexcept
+    {
+        std::uintptr_t b = bits.load(std::memory_order_relaxed);
+        const auto* p = reinterpret_cast<const Char*>(b & pointer_mask);
+        if (!p)
+        {
+            return 0;
+        }
+        if constexpr (tagged)
+        {
+            if (std::uintptr_t tag = b >> tag_shift)
+            {
+                return static_cast<std::size_t>(tag - 1);
+            }
+            std::size_t length = detail::string_length(p);
+            // Fails only if the object was reassigned meanwhile, in which
+            // case the new value must not be tagged with this length.
+            bits.compare_exchange_strong(b, pack(p, length), std::memory_order_relaxed);
+            return length;
+        }
+        else
+        {
+            return detail::string_length(p);
+        }
+    }
+
+    [[nodiscard]] std::basic_string<Char> string() const {return std::basic_string<Char>(view());}
+    [[nodiscard]] explicit operator std::basic_string<Char>() const {return string();}
+
+    [[nodiscard]] std::basic_string_view<Char> view() const noexcept {return {c_str(), length()};}
+    [[nodiscard]] explicit operator std::basic_string_view<Char>() const noexcept {return view();}
+
+    [[nodiscard]] bool operator==(const basic_packed_safe_string& other) const noexcept
+    {
+        std::size_t a = cached_length();
+        std::size_t b = other.cached_length();
+        if (a != npos && b != npos && a != b)
+        {
+            return false;
+        }
+        return view() == other.view();
+    }
+
+    [[nodiscard]] bool operator!=(const basic_packed_safe_string& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    [[nodiscard]] bool operator<(const basic_packed_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) < 0;
+    }
+
+    [[nodiscard]] bool operator<=(const basic_packed_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) <= 0;
+    }
+
+    [[nodiscard]] bool operator>(const basic_packed_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) > 0;
+    }
+
+    [[nodiscard]] bool operator>=(const basic_packed_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) >= 0;
+    }
+
+    // Mixed comparisons with basic_safe_string.  Each type converts to the
+    // other, so without exact matches these would be ambiguous (and in
+    // C++20, with reversed candidates, even more so).  They are templates
+    // so that they match basic_safe_string only and not, say, const Char*,
+    // which the member operators already handle.
+    template <typename Safe>
+    using if_safe = std::enable_if_t<std::is_same_v<Safe, basic_safe_string<Char>>, int>;
+
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator==(const basic_packed_safe_string& a, const Safe& b) noexcept
+    {
+        return a.view() == b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator==(const Safe& a, const basic_packed_safe_string& b) noexcept
+    {
+        return a.view() == b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator!=(const basic_packed_safe_string& a, const Safe& b) noexcept
+    {
+        return a.view() != b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator!=(const Safe& a, const basic_packed_safe_string& b) noexcept
+    {
+        return a.view() != b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator<(const basic_packed_safe_string& a, const Safe& b) noexcept
+    {
+        return a.view() < b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator<(const Safe& a, const basic_packed_safe_string& b) noexcept
+    {
+        return a.view() < b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator<=(const basic_packed_safe_string& a, const Safe& b) noexcept
+    {
+        return a.view() <= b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator<=(const Safe& a, const basic_packed_safe_string& b) noexcept
+    {
+        return a.view() <= b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator>(const basic_packed_safe_string& a, const Safe& b) noexcept
+    {
+        return a.view() > b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator>(const Safe& a, const basic_packed_safe_string& b) noexcept
+    {
+        return a.view() > b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator>=(const basic_packed_safe_string& a, const Safe& b) noexcept
+    {
+        return a.view() >= b.view();
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend bool operator>=(const Safe& a, const basic_packed_safe_string& b) noexcept
+    {
+        return a.view() >= b.view();
+    }
+#ifdef __cpp_impl_three_way_comparison
+    [[nodiscard]] std::strong_ordering operator<=>(const basic_packed_safe_string& other) const noexcept
+    {
+        return view().compare(other.view()) <=> 0;
+    }
+    template <typename Safe, if_safe<Safe> = 0>
+    [[nodiscard]] friend std::strong_ordering operator<=>(const basic_packed_safe_string& a,
+                                                          const Safe& b) noexcept
+    {
+        return a.view().compare(b.view()) <=> 0;
+    }
+#endif
+
+    using const_iterator = const Char*;
+    using sentinel = null_terminator_sentinel;
+
+    // As for basic_safe_string, end() is a sentinel so that iteration does
+    // not need the length; sized() uses the cached one.
+    [[nodiscard]] const_iterator begin() const noexcept { return c_str(); }
+    [[nodiscard]] constexpr sentinel end() const noexcept { return {}; }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr sentinel cend() const noexcept { return end(); }
+
+    [[nodiscard]] bool empty() const noexcept { return *c_str() == Char{}; }
+    [[nodiscard]] basic_sized_safe_string<Char> sized() const noexcept {return {c_str(), length()};}
+};
+
+static_assert(sizeof(basic_packed_safe_string<char>) == sizeof(void*));
+
+using packed_safe_string  = basic_packed_safe_string<char>;
+using packed_safe_wstring = basic_packed_safe_string<wchar_t>;
+
+} // namespace cinter
+
+#ifdef __cpp_lib_ranges
+namespace std::ranges
+{
+template <typename Char>
+inline constexpr bool enable_borrowed_range<cinter::basic_packed_safe_string<Char>> = true;
+} // namespace std::ranges
+#endif
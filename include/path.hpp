@@ -0,0 +1,540 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "codec.hpp"
+#include "safe_string.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CINTER_PATH_SSE2 1
+#endif
+// The scans load aligned 16-byte blocks, which never cross a page but do
+// read before the start and past the terminator of the path, possibly into
+// memory that ASan or TSan consider freed.
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#undef CINTER_PATH_SSE2
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#undef CINTER_PATH_SSE2
+#endif
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#ifdef __cpp_lib_ranges
+#include <ranges>
+#endif
+
+// Lexical manipulation of POSIX paths held in C strings: '/' is the only
+// separator and nothing touches the file system.
+
+namespace cinter
+{
+
+namespace detail
+{
+
+[[nodiscard]] inline unsigned path_lowest_bit(unsigned mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+[[nodiscard]] inline unsigned path_highest_bit(unsigned mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return 31 - static_cast<unsigned>(__builtin_clz(mask));
+#endif
+}
+
+#ifdef CINTER_PATH_SSE2
+// Masks of the terminators and separators in the aligned block holding p,
+// with the bits for bytes before p cleared.  block receives the address of
+// the block.
+[[nodiscard]] inline unsigned path_block_masks(const char* p, const char*& block, unsigned& slashes) noexcept
+{
+    const std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(p) & 15;
+    block = p - offset;
+    const __m128i v  = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+    const unsigned from = 0xffffu << offset;
+    slashes = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')))) & from;
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()))) & from;
+}
+#endif
+
+// Returns the first '/' or terminator at or after p.
+[[nodiscard]] inline const char* path_find_separator(const char* p) noexcept
+{
+#ifdef CINTER_PATH_SSE2
+    const char* block;
+    unsigned slashes;
+    unsigned stop = path_block_masks(p, block, slashes) | slashes;
+    while (stop == 0)
+    {
+        block += 16;
+        stop = path_block_masks(block, block, slashes) | slashes;
+    }
+    return block + path_lowest_bit(stop);
+#else
+    while (*p != '/' && *p != '\0')
+    {
+        ++p;
+    }
+    return p;
+#endif
+}
+
+struct path_scan_result
+{
+    std::size_t length;
+    // The last '/' of the path, or nullptr if there is none.
+    const char* last_slash;
+};
+
+// Finds the length and the last separator of p in one pass.
+[[nodiscard]] inline path_scan_result path_scan(const char* p) noexcept
+{
+    const char* last_slash = nullptr;
+#ifdef CINTER_PATH_SSE2
+    const char* block;
+    unsigned    slashes;
+    unsigned    zeros = path_block_masks(p, block, slashes);
+    while (zeros == 0)
+    {
+        if (slashes)
+        {
+            last_slash = block + path_highest_bit(slashes);
+        }
+        block += 16;
+        zeros = path_block_masks(block, block, slashes);
+    }
+    const unsigned end = path_lowest_bit(zeros);
+    slashes &= (1u << end) - 1;
+    if (slashes)
+    {
+        last_slash = block + path_highest_bit(slashes);
+    }
+    return {static_cast<std::size_t>(block + end - p), last_slash};
+#else
+    const char* q = p;
+    for (; *q != '\0'; ++q)
+    {
+        if (*q == '/')
+        {
+            last_slash = q;
+        }
+    }
+    return {static_cast<std::size_t>(q - p), last_slash};
+#endif
+}
+
+// The final component of p (of length length) without trailing separators,
+// as [first, last).  Returns false if p is empty or only separators.
+[[nodiscard]] inline bool path_final_component(const char* p, const path_scan_result& scan, const char*& first,
+                                               const char*& last) noexcept
+{
+    last = p + scan.length;
+    if (scan.last_slash == nullptr || scan.last_slash + 1 != last)
+    {
+        first = scan.last_slash ? scan.last_slash + 1 : p;
+        return first != last;
+    }
+    // Trailing separators are rare enough to strip one byte at a time.
+    while (last != p && last[-1] == '/')
+    {
+        --last;
+    }
+    first = last;
+    while (first != p && first[-1] != '/')
+    {
+        --first;
+    }
+    return first != last;
+}
+
+} // namespace detail
+
+[[nodiscard]] inline bool path_is_absolute(safe_string path) noexcept
+{
+    return *path.c_str() == '/';
+}
+
+// Returns the final component of path, like POSIX basename() but without
+// modifying or copying it: "/usr/lib/" gives "lib", "/" gives "/" and ""
+// gives ".".  The view points into path unless it is one of those two
+// constants, and it is null terminated whenever path has no trailing '/'.
+[[nodiscard]] inline std::string_view path_basename(safe_string path) noexcept
+{
+    const char* p = path.c_str();
+    const detail::path_scan_result scan = detail::path_scan(p);
+    const char* first;
+    const char* last;
+    if (detail::path_final_component(p, scan, first, last))
+    {
+        return {first, static_cast<std::size_t>(last - first)};
+    }
+    return scan.length == 0 ? std::string_view(".") : std::string_view(p, 1);
+}
+
+// Returns everything before the final component, like POSIX dirname():
+// "/usr/lib/" gives "/usr", "lib" gives ".", "/lib" and "/" give "/".  The
+// view is a prefix of path or one of those two constants.
+[[nodiscard]] inline std::string_view path_dirname(safe_string path) noexcept
+{
+    const char* p = path.c_str();
+    const detail::path_scan_result scan = detail::path_scan(p);
+    const char* first;
+    const char* last;
+    if (!detail::path_final_component(p, scan, first, last))
+    {
+        return scan.length == 0 ? std::string_view(".") : std::string_view(p, 1);
+    }
+    if (first == p)
+    {
+        return ".";
+    }
+    while (first != p && first[-1] == '/')
+    {
+        --first;
+    }
+    return first == p ? std::string_view(p, 1) : std::string_view(p, static_cast<std::size_t>(first - p));
+}
+
+namespace detail
+{
+
+// Position of the dot starting the extension of a basename, or npos.
+// Leading dots (".profile") and the names "." and ".." have none.
+[[nodiscard]] inline std::size_t path_extension_dot(std::string_view name) noexcept
+{
+    const std::size_t dot = name.rfind('.');
+    if (dot == std::string_view::npos || dot == 0 || name == ".." || name == "/")
+    {
+        return std::string_view::npos;
+    }
+    return dot;
+}
+
+} // namespace detail
+
+// Returns the extension of the basename including its dot, e.g. ".gz" for
+// "/tmp/a.tar.gz", or an empty view if there is none.
+[[nodiscard]] inline std::string_view path_extension(safe_string path) noexcept
+{
+    const std::string_view name = path_basename(path);
+    const std::size_t dot = detail::path_extension_dot(name);
+    return dot == std::string_view::npos ? std::string_view(name.data() + name.size(), 0) : name.substr(dot);
+}
+
+// Returns the basename without its extension.
+[[nodiscard]] inline std::string_view path_stem(safe_string path) noexcept
+{
+    const std::string_view name = path_basename(path);
+    return name.substr(0, detail::path_extension_dot(name));
+}
+
+/*
+path_component_range iterates over the components of a path as string
+views into it, skipping empty components, so "/usr//lib/" yields "usr" and
+"lib".  Components are not interpreted: "." and ".." are yielded as they
+are, and whether the path is absolute is path_is_absolute()'s business.
+Separators are found 16 bytes at a time with SSE2.
+
+    for (std::string_view component : cinter::path_components(fts_entry->fts_path))
+    {
+        ...
+    }
+
+The end is a null_terminator_sentinel, so nothing is scanned until the
+loop gets there.
+*/
+class path_component_range
+{
+    const char* path_ = nullptr;
+
+    [[nodiscard]] static const char* skip_separators(const char* p) noexcept
+    {
+        while (*p == '/')
+        {
+            ++p;
+        }
+        return p;
+    }
+
+public:
+    class iterator
+    {
+        const char* first_ = nullptr;
+        const char* last_  = nullptr;
+
+        friend class path_component_range;
+
+        explicit iterator(const char* first) noexcept : first_(first), last_(detail::path_find_separator(first)) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::string_view;
+
+        iterator() noexcept = default;
+
+        [[nodiscard]] std::string_view operator*() const noexcept
+        {
+            return {first_, static_cast<std::size_t>(last_ - first_)};
+        }
+
+        iterator& operator++() noexcept
+        {
+            first_ = skip_separators(last_);
+            last_  = detail::path_find_separator(first_);
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        [[nodiscard]] friend bool operator==(const iterator& a, const iterator& b) noexcept
+        {
+            return a.first_ == b.first_;
+        }
+
+        [[nodiscard]] friend bool operator!=(const iterator& a, const iterator& b) noexcept
+        {
+            return a.first_ != b.first_;
+        }
+
+        [[nodiscard]] friend bool operator==(const iterator& it, null_terminator_sentinel) noexcept
+        {
+            return *it.first_ == '\0';
+        }
+
+        [[nodiscard]] friend bool operator==(null_terminator_sentinel, const iterator& it) noexcept
+        {
+            return *it.first_ == '\0';
+        }
+
+        [[nodiscard]] friend bool operator!=(const iterator& it, null_terminator_sentinel) noexcept
+        {
+            return *it.first_ != '\0';
+        }
+
+        [[nodiscard]] friend bool operator!=(null_terminator_sentinel, const iterator& it) noexcept
+        {
+            return *it.first_ != '\0';
+        }
+    };
+
+    path_component_range() noexcept = default;
+    explicit path_component_range(safe_string path) noexcept : path_(path.c_str()) {}
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator(skip_separators(path_)); }
+    [[nodiscard]] null_terminator_sentinel end() const noexcept { return {}; }
+};
+
+[[nodiscard]] inline path_component_range path_components(safe_string path) noexcept
+{
+    return path_component_range(path);
+}
+
+// Writes base and relative joined by one '/' to out, null terminated, and
+// returns the length written.  An absolute relative replaces base, and an
+// empty one leaves it unchanged.  The result is not normalized; pass it to
+// path_normalize() to remove "." and "..".
+inline codec_result path_join(safe_string base, safe_string relative, char* out, std::size_t capacity) noexcept
+{
+    const char* b = base.c_str();
+    const char* r = relative.c_str();
+    std::size_t base_length = 0;
+    if (*r != '/')
+    {
+        base_length = std::strlen(b);
+    }
+    const std::size_t relative_length = std::strlen(r);
+    const bool separator = base_length != 0 && relative_length != 0 && b[base_length - 1] != '/';
+    const std::size_t length = base_length + separator + relative_length;
+    if (length >= capacity)
+    {
+        return codec_error::buffer_too_small;
+    }
+    std::memmove(out, b, base_length);
+    if (separator)
+    {
+        out[base_length] = '/';
+    }
+    std::memmove(out + base_length + separator, r, relative_length);
+    out[length] = '\0';
+    return static_cast<std::ptrdiff_t>(length);
+}
+
+// Appends base and relative joined by one '/' to out.
+inline codec_result path_join(safe_string base, safe_string relative, std::string& out)
+{
+    const std::size_t old_size = out.size();
+    out.resize(old_size + std::strlen(base.c_str()) + std::strlen(relative.c_str()) + 2);
+    const codec_result written = path_join(base, relative, &out[old_size], out.size() - old_size);
+    out.resize(old_size + static_cast<std::size_t>(written.value()));
+    return written;
+}
+
+// Writes the lexically normal form of path to out, null terminated, and
+// returns its length: repeated separators are collapsed, "." components
+// are removed, ".." removes the component before it (or is dropped right
+// after the root, or kept at the start of a relative path), and a trailing
+// '/' is removed.  An empty result becomes ".".  Symbolic links are not
+// followed, so "a/link/.." may name a different directory than "a".
+//
+// The output is never longer than the input, except that "" becomes ".",
+// so out may be the buffer holding path to normalize it in place.
+inline codec_result path_normalize(safe_string path, char* out, std::size_t capacity) noexcept
+{
+    const char* p = path.c_str();
+    char* o = out;
+    char* const end = out + capacity;
+    // out[0, fixed) cannot be removed by "..": the root or leading "..".
+    std::size_t fixed = 0;
+    if (*p == '/')
+    {
+        if (capacity < 2)
+        {
+            return codec_error::buffer_too_small;
+        }
+        *o++ = '/';
+        fixed = 1;
+    }
+    for (;;)
+    {
+        while (*p == '/')
+        {
+            ++p;
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        const char* last = detail::path_find_separator(p);
+        const std::size_t length = static_cast<std::size_t>(last - p);
+        if (length == 1 && p[0] == '.')
+        {
+            p = last;
+            continue;
+        }
+        const bool parent = length == 2 && p[0] == '.' && p[1] == '.';
+        if (parent)
+        {
+            if (static_cast<std::size_t>(o - out) > fixed)
+            {
+                char* const floor = out + fixed;
+                while (o != floor && o[-1] != '/')
+                {
+                    --o;
+                }
+                // Drop the separator too, unless it is the root.
+                if (o != floor && o - 1 != out)
+                {
+                    --o;
+                }
+                p = last;
+                continue;
+            }
+            if (fixed == 1 && out[0] == '/')
+            {
+                p = last;
+                continue;
+            }
+        }
+        const bool separator = o != out && o[-1] != '/';
+        if (static_cast<std::size_t>(end - o) <= separator + length)
+        {
+            return codec_error::buffer_too_small;
+        }
+        if (separator)
+        {
+            *o++ = '/';
+        }
+        // memmove: when normalizing in place, o trails p.
+        std::memmove(o, p, length);
+        o += length;
+        if (parent)
+        {
+            fixed = static_cast<std::size_t>(o - out);
+        }
+        p = last;
+    }
+    if (o == out)
+    {
+        if (capacity < 2)
+        {
+            return codec_error::buffer_too_small;
+        }
+        *o++ = '.';
+    }
+    *o = '\0';
+    return o - out;
+}
+
+// Appends the lexically normal form of path to out.
+inline codec_result path_normalize(safe_string path, std::string& out)
+{
+    const std::size_t old_size = out.size();
+    out.resize(old_size + std::strlen(path.c_str()) + 2);
+    const codec_result written = path_normalize(path, &out[old_size], out.size() - old_size);
+    out.resize(old_size + static_cast<std::size_t>(written.value()));
+    return written;
+}
+
+} // namespace cinter
+
+#ifdef __cpp_lib_ranges
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<cinter::path_component_range> = true;
+template <>
+inline constexpr bool std::ranges::enable_view<cinter::path_component_range> = true;
+#endif
@@ -0,0 +1,812 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cinter
+{
+
+/*
+radix_tree is an adaptive radix tree (Leis, Kemper and Neumann, ICDE 2013)
+mapping C-strings to values.  Keys are consumed one byte at a time up to
+and including the terminator, so no key length is computed up front and no
+key is a prefix of another; a key that is a prefix of longer keys hangs off
+its node under the terminator byte.  That makes longest-prefix matching a
+single descent: every terminator child passed on the way down is a shorter
+match.
+
+Inner nodes grow from 4 to 16, 48 and 256 children as needed.  Node4 and
+node16 keep their keys sorted and are scanned until the first key that is
+not smaller.  Paths with a single child are compressed into the node
+prefix.
+
+Concurrency follows optimistic lock coupling (Leis et al., DaMoN 2016).
+Lookups take no locks: they read a node's version, read the node, and
+re-check the version before moving on, restarting if a writer changed the
+node in between.  Writers are serialized by a mutex and bump the version of
+every node they change.  Values are never modified in place: assigning to
+an existing key publishes a new leaf.  Replaced nodes and leaves are kept
+until the tree is destroyed, so a reader never touches freed memory and an
+entry returned by a lookup stays valid for the lifetime of the tree.
+
+for_each_prefix() takes the writer mutex, so a scan sees a consistent tree
+and blocks writers, but not readers, while it runs.
+
+    cinter::radix_tree<int> rules;
+    rules.insert_or_assign("/usr", 1);
+    rules.insert_or_assign("/usr/local", 2);
+    auto m = rules.longest_prefix_match("/usr/local/bin/tool");
+    if (m.is_ok()) { use(m.value()->key, m.value()->value); }   // "/usr/local", 2
+*/
+template <typename Value>
+class radix_tree
+{
+public:
+    struct entry
+    {
+        safe_string key;
+        std::size_t length;
+        Value       value;
+    };
+
+    using find_result = sentinel_result<const entry*, nullptr, not_equal_to<const entry*>>;
+
+private:
+    enum class node_type : std::uint8_t
+    {
+        leaf,
+        node4,
+        node16,
+        node48,
+        node256
+    };
+
+    static constexpr std::uint64_t locked_bit   = 1;
+    static constexpr std::uint64_t obsolete_bit = 2;
+    static constexpr std::uint64_t version_step = 4;
+
+    struct node
+    {
+        std::atomic<std::uint64_t>        version{0};
+        const node_type                   type;
+        std::atomic<std::uint16_t>        count{0};
+        // Bytes of the compressed path.  They point into the key of a leaf in
+        // this subtree, which is never freed while the tree exists.
+        std::atomic<const unsigned char*> prefix{nullptr};
+        std::atomic<std::uint32_t>        prefix_length{0};
+
+        explicit node(node_type t) noexcept : type(t) {}
+    };
+
+    struct leaf : node
+    {
+        std::unique_ptr<unsigned char[]> storage;
+        entry                            item;
+
+        leaf(const unsigned char* key, std::size_t length, Value value)
+            : node(node_type::leaf)
+            , storage(new unsigned char[length + 1])
+            , item{nullptr, length, std::move(value)}
+        {
+            std::memcpy(storage.get(), key, length + 1);
+            item.key = reinterpret_cast<const char*>(storage.get());
+        }
+
+        [[nodiscard]] const unsigned char* key() const noexcept { return storage.get(); }
+    };
+
+    struct node4 : node
+    {
+        std::atomic<unsigned char> keys[4]{};
+        std::atomic<node*>         children[4]{};
+        node4() noexcept : node(node_type::node4) {}
+    };
+
+    struct node16 : node
+    {
+        std::atomic<unsigned char> keys[16]{};
+        std::atomic<node*>         children[16]{};
+        node16() noexcept : node(node_type::node16) {}
+    };
+
+    struct node48 : node
+    {
+        // 0 for an absent byte, otherwise the child slot plus one.
+        std::atomic<unsigned char> index[256]{};
+        std::atomic<node*>         children[48]{};
+        node48() noexcept : node(node_type::node48) {}
+    };
+
+    struct node256 : node
+    {
+        std::atomic<node*> children[256]{};
+        node256() noexcept : node(node_type::node256) {}
+    };
+
+    node256                  root_;
+    std::mutex               write_mutex_;
+    std::vector<node*>       retired_;
+    std::atomic<std::size_t> size_{0};
+
+    // ---- optimistic lock coupling -----------------------------------------
+    //
+    // Readers race with the writer on every node field, so all of them are
+    // atomics.  The writer stores them with release while it holds the node
+    // lock, and readers load them with acquire, so a reader that sees any of
+    // those stores also sees the locked version and fails validate().  On
+    // x86 both are plain moves.
+
+    // Waits for n to be unlocked and reads its version.  Returns false if n
+    // was replaced and the lookup must restart from the root.
+    [[nodiscard]] static bool read_lock(const node* n, std::uint64_t& v) noexcept
+    {
+        for (;;)
+        {
+            v = n->version.load(std::memory_order_acquire);
+            if (v & obsolete_bit)
+            {
+                return false;
+            }
+            if (!(v & locked_bit))
+            {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Returns false if n changed since read_lock returned v.
+    [[nodiscard]] static bool validate(const node* n, std::uint64_t v) noexcept
+    {
+        return n->version.load(std::memory_order_acquire) == v;
+    }
+
+    // The release stores that follow order the locked version before them.
+    static void write_lock(node* n) noexcept
+    {
+        n->version.store(n->version.load(std::memory_order_relaxed) | locked_bit, std::memory_order_relaxed);
+    }
+
+    static void write_unlock(node* n, bool obsolete = false) noexcept
+    {
+        const std::uint64_t v = n->version.load(std::memory_order_relaxed) + (version_step - locked_bit);
+        n->version.store(obsolete ? v | obsolete_bit : v, std::memory_order_release);
+    }
+
+    // ---- node operations ------------------------------------------------
+
+    [[nodiscard]] static std::atomic<node*>* child_slot(node* n, unsigned char byte) noexcept
+    {
+        const unsigned count = n->count.load(std::memory_order_acquire);
+        switch (n->type)
+        {
+            case node_type::node4:
+            {
+                auto* n4 = static_cast<node4*>(n);
+                for (unsigned i = 0; i < count && i < 4; ++i)
+                {
+                    if (n4->keys[i].load(std::memory_order_acquire) == byte)
+                    {
+                        return &n4->children[i];
+                    }
+                }
+                return nullptr;
+            }
+            case node_type::node16:
+            {
+                auto* n16 = static_cast<node16*>(n);
+                // The keys are sorted, so the scan stops at the first key
+                // that is not smaller.  They are atomics, which rules out one
+                // SSE2 compare: gathering them into a vector costs more than
+                // it saves.
+                for (unsigned i = 0; i < count && i < 16; ++i)
+                {
+                    const unsigned char key = n16->keys[i].load(std::memory_order_acquire);
+                    if (key >= byte)
+                    {
+                        return key == byte ? &n16->children[i] : nullptr;
+                    }
+                }
+                return nullptr;
+            }
+            case node_type::node48:
+            {
+                auto*          n48  = static_cast<node48*>(n);
+                const unsigned slot = n48->index[byte].load(std::memory_order_acquire);
+                return slot && slot <= 48 ? &n48->children[slot - 1] : nullptr;
+            }
+            case node_type::node256:
+                return &static_cast<node256*>(n)->children[byte];
+            case node_type::leaf:
+                break;
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] static node* find_child(const node* n, unsigned char byte) noexcept
+    {
+        std::atomic<node*>* slot = child_slot(const_cast<node*>(n), byte);
+        return slot ? slot->load(std::memory_order_acquire) : nullptr;
+    }
+
+    [[nodiscard]] static bool is_full(const node* n) noexcept
+    {
+        const unsigned count = n->count.load(std::memory_order_relaxed);
+        switch (n->type)
+        {
+            case node_type::node4:
+                return count == 4;
+            case node_type::node16:
+                return count == 16;
+            case node_type::node48:
+                return count == 48;
+            default:
+                return false;
+        }
+    }
+
+    template <typename Sorted>
+    static void insert_sorted(Sorted* n, unsigned char byte, node* child) noexcept
+    {
+        const unsigned count = n->count.load(std::memory_order_relaxed);
+        unsigned       pos   = 0;
+        while (pos < count && n->keys[pos].load(std::memory_order_relaxed) < byte)
+        {
+            ++pos;
+        }
+        for (unsigned i = count; i > pos; --i)
+        {
+            n->keys[i].store(n->keys[i - 1].load(std::memory_order_relaxed), std::memory_order_release);
+            n->children[i].store(n->children[i - 1].load(std::memory_order_relaxed), std::memory_order_release);
+        }
+        n->keys[pos].store(byte, std::memory_order_release);
+        n->children[pos].store(child, std::memory_order_release);
+        n->count.store(static_cast<std::uint16_t>(count + 1), std::memory_order_release);
+    }
+
+    // Adds a child to a node that is not full.  The caller holds its lock.
+    static void add_child(node* n, unsigned char byte, node* child) noexcept
+    {
+        switch (n->type)
+        {
+            case node_type::node4:
+                insert_sorted(static_cast<node4*>(n), byte, child);
+                break;
+            case node_type::node16:
+                insert_sorted(static_cast<node16*>(n), byte, child);
+                break;
+            case node_type::node48:
+            {
+                auto*          n48   = static_cast<node48*>(n);
+                const unsigned count = n48->count.load(std::memory_order_relaxed);
+                n48->children[count].store(child, std::memory_order_release);
+                n48->index[byte].store(static_cast<unsigned char>(count + 1), std::memory_order_release);
+                n48->count.store(static_cast<std::uint16_t>(count + 1), std::memory_order_release);
+                break;
+            }
+            case node_type::node256:
+                static_cast<node256*>(n)->children[byte].store(child, std::memory_order_release);
+                n->count.store(static_cast<std::uint16_t>(n->count.load(std::memory_order_relaxed) + 1),
+                               std::memory_order_release);
+                break;
+            case node_type::leaf:
+                break;
+        }
+    }
+
+    // Calls fn(byte, child) for every child in byte order.
+    template <typename Fn>
+    static void for_each_child(node* n, Fn&& fn)
+    {
+        const unsigned count = n->count.load(std::memory_order_relaxed);
+        switch (n->type)
+        {
+            case node_type::node4:
+                for (unsigned i = 0; i < count; ++i)
+                {
+                    fn(static_cast<node4*>(n)->keys[i].load(), static_cast<node4*>(n)->children[i].load());
+                }
+                break;
+            case node_type::node16:
+                for (unsigned i = 0; i < count; ++i)
+                {
+                    fn(static_cast<node16*>(n)->keys[i].load(), static_cast<node16*>(n)->children[i].load());
+                }
+                break;
+            case node_type::node48:
+                for (unsigned b = 0; b < 256; ++b)
+                {
+                    if (const unsigned slot = static_cast<node48*>(n)->index[b].load())
+                    {
+                        fn(static_cast<unsigned char>(b), static_cast<node48*>(n)->children[slot - 1].load());
+                    }
+                }
+                break;
+            case node_type::node256:
+                for (unsigned b = 0; b < 256; ++b)
+                {
+                    if (node* child = static_cast<node256*>(n)->children[b].load())
+                    {
+                        fn(static_cast<unsigned char>(b), child);
+                    }
+                }
+                break;
+            case node_type::leaf:
+                break;
+        }
+    }
+
+    // Returns a copy of n with room for one more child.
+    [[nodiscard]] static node* grow(node* n)
+    {
+        node* bigger = nullptr;
+        switch (n->type)
+        {
+            case node_type::node4:
+                bigger = new node16();
+                break;
+            case node_type::node16:
+                bigger = new node48();
+                break;
+            default:
+                bigger = new node256();
+                break;
+        }
+        bigger->prefix.store(n->prefix.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bigger->prefix_length.store(n->prefix_length.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        for_each_child(n, [bigger](unsigned char byte, node* child) { add_child(bigger, byte, child); });
+        return bigger;
+    }
+
+    static void destroy(node* n) noexcept
+    {
+        if (n->type == node_type::leaf)
+        {
+            delete static_cast<leaf*>(n);
+            return;
+        }
+        for_each_child(n, [](unsigned char, node* child) { destroy(child); });
+        switch (n->type)
+        {
+            case node_type::node4:
+                delete static_cast<node4*>(n);
+                break;
+            case node_type::node16:
+                delete static_cast<node16*>(n);
+                break;
+            case node_type::node48:
+                delete static_cast<node48*>(n);
+                break;
+            case node_type::node256:
+                delete static_cast<node256*>(n);
+                break;
+            case node_type::leaf:
+                break;
+        }
+    }
+
+    static void destroy_single(node* n) noexcept
+    {
+        switch (n->type)
+        {
+            case node_type::leaf:
+                delete static_cast<leaf*>(n);
+                break;
+            case node_type::node4:
+                delete static_cast<node4*>(n);
+                break;
+            case node_type::node16:
+                delete static_cast<node16*>(n);
+                break;
+            case node_type::node48:
+                delete static_cast<node48*>(n);
+                break;
+            case node_type::node256:
+                delete static_cast<node256*>(n);
+                break;
+        }
+    }
+
+    // Number of leading bytes of the node prefix that match key.  Stops at
+    // the key terminator because prefixes never contain one.
+    [[nodiscard]] static std::uint32_t match_prefix(const node* n, const unsigned char* key) noexcept
+    {
+        const unsigned char* prefix = n->prefix.load(std::memory_order_acquire);
+        const std::uint32_t  length = n->prefix_length.load(std::memory_order_acquire);
+        std::uint32_t        i      = 0;
+        while (i < length && prefix[i] == key[i])
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    [[nodiscard]] static const leaf* as_leaf(const node* n) noexcept
+    {
+        return n && n->type == node_type::leaf ? static_cast<const leaf*>(n) : nullptr;
+    }
+
+    // True if the leaf key, from depth on, is a prefix of key from depth on.
+    // True if the leaf key is a prefix of key.  Bytes before depth are known
+    // to match.
+    [[nodiscard]] static bool leaf_is_prefix(const leaf* l, const unsigned char* key, std::size_t depth) noexcept
+    {
+        for (std::size_t i = depth; i < l->item.length; ++i)
+        {
+            if (l->key()[i] != key[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // True if key is a prefix of the leaf key.
+    [[nodiscard]] static bool leaf_starts_with(const leaf* l, const unsigned char* key, std::size_t depth) noexcept
+    {
+        for (std::size_t i = depth; key[i]; ++i)
+        {
+            if (l->key()[i] != key[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] static bool leaf_equals(const leaf* l, const unsigned char* key, std::size_t depth) noexcept
+    {
+        return std::strcmp(reinterpret_cast<const char*>(l->key() + depth),
+                           reinterpret_cast<const char*>(key + depth))
+               == 0;
+    }
+
+    // One optimistic descent.  Returns false if a concurrent writer changed a
+    // node on the path, in which case the caller restarts.
+    [[nodiscard]] bool lookup(const unsigned char* key, const entry*& result) const noexcept
+    {
+        result            = nullptr;
+        const node*   n   = &root_;
+        std::uint64_t v   = 0;
+        std::size_t depth = 0;
+        if (!read_lock(n, v))
+        {
+            return false;
+        }
+        for (;;)
+        {
+            const std::uint32_t length = n->prefix_length.load(std::memory_order_acquire);
+            if (match_prefix(n, key + depth) != length)
+            {
+                return validate(n, v);
+            }
+            depth += length;
+            const node* child = find_child(n, key[depth]);
+            if (!validate(n, v))
+            {
+                return false;
+            }
+            if (!child)
+            {
+                return true;
+            }
+            if (const leaf* l = as_leaf(child))
+            {
+                result = leaf_equals(l, key, depth) ? &l->item : nullptr;
+                return true;
+            }
+            std::uint64_t child_version = 0;
+            if (!read_lock(child, child_version) || !validate(n, v))
+            {
+                return false;
+            }
+            n     = child;
+            v     = child_version;
+            depth = depth + 1;
+        }
+    }
+
+    [[nodiscard]] bool lookup_longest_prefix(const unsigned char* key, const entry*& result) const noexcept
+    {
+        result            = nullptr;
+        const node*   n   = &root_;
+        std::uint64_t v   = 0;
+        std::size_t depth = 0;
+        if (!read_lock(n, v))
+        {
+            return false;
+        }
+        for (;;)
+        {
+            const std::uint32_t length = n->prefix_length.load(std::memory_order_acquire);
+            if (match_prefix(n, key + depth) != length)
+            {
+                return validate(n, v);
+            }
+            depth += length;
+            // A terminator child is a key equal to key[0..depth).
+            const node* terminator = find_child(n, 0);
+            const node* child      = key[depth] ? find_child(n, key[depth]) : nullptr;
+            if (!validate(n, v))
+            {
+                return false;
+            }
+            if (const leaf* l = as_leaf(terminator))
+            {
+                result = &l->item;
+            }
+            if (!child)
+            {
+                return true;
+            }
+            if (const leaf* l = as_leaf(child))
+            {
+                if (leaf_is_prefix(l, key, depth + 1))
+                {
+                    result = &l->item;
+                }
+                return true;
+            }
+            std::uint64_t child_version = 0;
+            if (!read_lock(child, child_version) || !validate(n, v))
+            {
+                return false;
+            }
+            n     = child;
+            v     = child_version;
+            depth = depth + 1;
+        }
+    }
+
+    void retire(node* n)
+    {
+        retired_.push_back(n);
+    }
+
+    // Replaces the child of parent under byte.  The caller holds the writer
+    // mutex; parent is locked for the store.
+    static void replace_child(node* parent, unsigned char byte, node* child) noexcept
+    {
+        write_lock(parent);
+        child_slot(parent, byte)->store(child, std::memory_order_release);
+        write_unlock(parent);
+    }
+
+    template <typename Fn>
+    static void visit(const node* n, Fn& fn)
+    {
+        if (const leaf* l = as_leaf(n))
+        {
+            fn(static_cast<const entry&>(l->item));
+            return;
+        }
+        for_each_child(const_cast<node*>(n), [&fn](unsigned char, node* child) { visit(child, fn); });
+    }
+
+public:
+    radix_tree() = default;
+
+    radix_tree(const radix_tree& other) = delete;
+    radix_tree& operator=(const radix_tree& other) = delete;
+
+    ~radix_tree() noexcept
+    {
+        for_each_child(&root_, [](unsigned char, node* child) { destroy(child); });
+        for (node* n : retired_)
+        {
+            destroy_single(n);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    // Inserts key, or publishes a new value for it.  Returns true if the key
+    // was inserted and false if it was assigned.  A null key is the empty
+    // string.
+    bool insert_or_assign(safe_string key_string, Value value)
+    {
+        const unsigned char* key = reinterpret_cast<const unsigned char*>(key_string.c_str());
+        std::lock_guard<std::mutex> lock(write_mutex_);
+
+        node*         parent      = nullptr;
+        unsigned char parent_byte = 0;
+        node*         n           = &root_;
+        std::size_t   depth       = 0;
+        for (;;)
+        {
+            const std::uint32_t length  = n->prefix_length.load(std::memory_order_relaxed);
+            const std::uint32_t matched = match_prefix(n, key + depth);
+            if (matched != length)
+            {
+                // Split the compressed path: a new node4 takes the matching
+                // part of the prefix and gets n and a new leaf as children.
+                const unsigned char* prefix   = n->prefix.load(std::memory_order_relaxed);
+                auto*                new_leaf = new leaf(key, std::strlen(reinterpret_cast<const char*>(key)), std::move(value));
+                auto*                split    = new node4();
+                split->prefix.store(prefix, std::memory_order_relaxed);
+                split->prefix_length.store(matched, std::memory_order_relaxed);
+                add_child(split, prefix[matched], n);
+                add_child(split, key[depth + matched], new_leaf);
+
+                write_lock(n);
+                n->prefix.store(prefix + matched + 1, std::memory_order_release);
+                n->prefix_length.store(length - matched - 1, std::memory_order_release);
+                replace_child(parent, parent_byte, split);
+                write_unlock(n);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            depth += length;
+
+            const unsigned char byte  = key[depth];
+            node*               child = find_child(n, byte);
+            if (!child)
+            {
+                auto* new_leaf
+                    = new leaf(key, depth + std::strlen(reinterpret_cast<const char*>(key + depth)), std::move(value));
+                if (is_full(n))
+                {
+                    node* bigger = grow(n);
+                    add_child(bigger, byte, new_leaf);
+                    write_lock(n);
+                    replace_child(parent, parent_byte, bigger);
+                    write_unlock(n, true);
+                    retire(n);
+                }
+                else
+                {
+                    write_lock(n);
+                    add_child(n, byte, new_leaf);
+                    write_unlock(n);
+                }
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            if (const leaf* existing = as_leaf(child))
+            {
+                if (leaf_equals(existing, key, depth))
+                {
+                    auto* replacement = new leaf(key, existing->item.length, std::move(value));
+                    replace_child(n, byte, replacement);
+                    retire(const_cast<leaf*>(existing));
+                    return false;
+                }
+                // Two keys share key[0..depth]; push both under a node4 whose
+                // prefix is the rest of their common part.
+                const unsigned char* other  = existing->key();
+                std::size_t          common = depth + 1;
+                while (other[common] == key[common])
+                {
+                    ++common;
+                }
+                auto* new_leaf
+                    = new leaf(key, common + std::strlen(reinterpret_cast<const char*>(key + common)), std::move(value));
+                auto* split    = new node4();
+                split->prefix.store(new_leaf->key() + depth + 1, std::memory_order_relaxed);
+                split->prefix_length.store(static_cast<std::uint32_t>(common - depth - 1), std::memory_order_relaxed);
+                add_child(split, other[common], child);
+                add_child(split, key[common], new_leaf);
+                replace_child(n, byte, split);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            parent      = n;
+            parent_byte = byte;
+            n           = child;
+            depth += 1;
+        }
+    }
+
+    // Exact lookup.  Lock free.
+    [[nodiscard]] find_result find(safe_string key) const noexcept
+    {
+        const unsigned char* k      = reinterpret_cast<const unsigned char*>(key.c_str());
+        const entry*         result = nullptr;
+        while (!lookup(k, result))
+        {
+        }
+        return result;
+    }
+
+    // The entry with the longest key that is a prefix of key.  Lock free.
+    [[nodiscard]] find_result longest_prefix_match(safe_string key) const noexcept
+    {
+        const unsigned char* k      = reinterpret_cast<const unsigned char*>(key.c_str());
+        const entry*         result = nullptr;
+        while (!lookup_longest_prefix(k, result))
+        {
+        }
+        return result;
+    }
+
+    // Calls fn(const entry&) for every key starting with prefix, in
+    // lexicographic byte order.  Blocks writers while it runs.
+    template <typename Fn>
+    void for_each_prefix(safe_string prefix_string, Fn fn)
+    {
+        const unsigned char* key = reinterpret_cast<const unsigned char*>(prefix_string.c_str());
+        std::lock_guard<std::mutex> lock(write_mutex_);
+
+        const node* n     = &root_;
+        std::size_t depth = 0;
+        for (;;)
+        {
+            const std::uint32_t length  = n->prefix_length.load(std::memory_order_relaxed);
+            const std::uint32_t matched = match_prefix(n, key + depth);
+            if (matched != length)
+            {
+                // The query either ends inside the compressed path, in which
+                // case the whole subtree matches, or diverges from it.
+                if (key[depth + matched] == 0)
+                {
+                    visit(n, fn);
+                }
+                return;
+            }
+            depth += length;
+            if (key[depth] == 0)
+            {
+                visit(n, fn);
+                return;
+            }
+            const node* child = find_child(n, key[depth]);
+            if (!child)
+            {
+                return;
+            }
+            if (const leaf* l = as_leaf(child))
+            {
+                if (leaf_starts_with(l, key, depth + 1))
+                {
+                    fn(static_cast<const entry&>(l->item));
+                }
+                return;
+            }
+            n = child;
+            depth += 1;
+        }
+    }
+};
+
+} // namespace cinter
@@ -0,0 +1,613 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "linux_records.hpp"
+#include "path.hpp"
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include "string_table.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Canonicalization of file names with the results cached and kept up to
+// date with inotify.  This header is only usable on Linux.
+
+namespace cinter
+{
+
+// An errno value, or 0.
+using realpath_status = sentinel_result<int, 0>;
+
+struct realpath_result
+{
+    realpath_status status;
+    // The canonical path, or null if status has_error().
+    safe_string     path;
+};
+
+/*
+realpath_cache answers realpath(3) queries from memory.  realpath() costs
+an lstat() per component and a readlink() per symbolic link on every call;
+the cache resolves each lexical prefix of an absolute path once, with one
+lstat() for its last component, and remembers the outcome, so a path
+below an already resolved directory costs one lstat() and a repeated
+lookup costs a hash probe under a shared lock and no system calls.
+Failures that depend only on the file system (ENOENT, ENOTDIR, EACCES,
+ENAMETOOLONG, and ELOOP for a cycle of symbolic links) are cached as well.
+
+Every directory a cached step looked into is watched with inotify.
+Creating, removing, renaming or changing the attributes of an entry in it
+invalidates the steps that looked that entry up and everything resolved
+through them, such as the paths below a renamed directory or behind a
+retargeted symbolic link.  Events are applied by process_events(), which
+every lookup that misses also calls first.  Long-lived users should poll
+fd() for readability in their event loop, or call process_events() before
+each batch of lookups; until then a hit may return a result that a
+concurrent change has made stale.  Mounts are not reported by inotify;
+call invalidate() after mounting or unmounting.
+
+Relative paths, chains of more than 40 symbolic links, and anything the
+cache cannot track (for instance when the inotify watch limit is reached)
+are passed to realpath() itself.
+
+    cinter::realpath_cache paths;
+    cinter::realpath_result r = paths.resolve(fts_entry->fts_path);
+    if (r.status.is_ok())
+    {
+        use(r.path);
+    }
+
+Canonical paths are interned, so a safe_string returned by resolve() stays
+valid for the lifetime of the cache.  So do the keys of every entry ever
+resolved; memory grows with the number of distinct paths looked up.
+realpath_cache is thread safe.
+*/
+class realpath_cache
+{
+    using id_type = string_table::id_type;
+
+    static constexpr id_type npos = string_table::npos;
+
+    // Linux's limit on symbolic links followed in one lookup (MAXSYMLINKS).
+    static constexpr int max_links = 40;
+
+    static constexpr std::uint32_t watch_mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB
+                                                | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR | IN_EXCL_UNLINK;
+
+    enum class state : std::uint8_t
+    {
+        unresolved,
+        resolving,
+        resolved
+    };
+
+    // A dependent entry, valid while the entry's generation is unchanged.
+    struct edge
+    {
+        id_type       id;
+        std::uint32_t generation;
+    };
+
+    struct entry
+    {
+        std::uint32_t     generation = 0;
+        state             status     = state::unresolved;
+        bool              directory  = false;
+        int               error      = 0;
+        id_type           result     = npos;
+        // Entries resolved through this one.
+        std::vector<edge> dependents;
+    };
+
+    mutable std::shared_mutex              lock_;
+    int                                    fd_;
+    // Lexical paths looked up, and their entries.
+    string_table                           keys_;
+    std::vector<entry>                     entries_;
+    // Canonical paths, and the watch of each one that is a watched directory.
+    // inotify has one watch per inode, so a directory known by several paths
+    // (through bind mounts) shares one watch between them.
+    string_table                           results_;
+    std::vector<int>                       watches_;
+    std::unordered_multimap<int, id_type>  watched_dirs_;
+    // Canonical paths that were lstat()ed, and the entries depending on each.
+    string_table                           dirents_;
+    std::vector<std::vector<edge>>         dirent_dependents_;
+    std::vector<edge>                      pending_;
+
+    [[nodiscard]] static bool cacheable_error(int error) noexcept
+    {
+        return error == ENOENT || error == ENOTDIR || error == EACCES || error == ENAMETOOLONG;
+    }
+
+    [[nodiscard]] static std::string child_path(std::string_view dir, std::string_view name)
+    {
+        std::string path;
+        path.reserve(dir.size() + 1 + name.size());
+        path += dir;
+        if (dir != "/")
+        {
+            path += '/';
+        }
+        path += name;
+        return path;
+    }
+
+    [[nodiscard]] id_type intern_result(safe_string path)
+    {
+        const id_type id = results_.intern(path);
+        if (id == watches_.size())
+        {
+            watches_.push_back(-1);
+        }
+        return id;
+    }
+
+    // Records that id must be invalidated with the list's owner.  Edges to
+    // entries invalidated since are dropped when the list would grow.
+    void add_dependent(std::vector<edge>& list, id_type id)
+    {
+        if (list.size() == list.capacity())
+        {
+            list.erase(std::remove_if(list.begin(), list.end(),
+                                      [this](const edge& e) { return entries_[e.id].generation != e.generation; }),
+                       list.end());
+        }
+        list.push_back(edge{id, entries_[id].generation});
+    }
+
+    // Invalidates the entries of list and, transitively, their dependents.
+    void invalidate_dependents(std::vector<edge>& list)
+    {
+        pending_.insert(pending_.end(), list.begin(), list.end());
+        list.clear();
+        while (!pending_.empty())
+        {
+            const edge e = pending_.back();
+            pending_.pop_back();
+            entry& dependent = entries_[e.id];
+            if (dependent.generation != e.generation || dependent.status != state::resolved)
+            {
+                continue;
+            }
+            dependent.status = state::unresolved;
+            ++dependent.generation;
+            pending_.insert(pending_.end(), dependent.dependents.begin(), dependent.dependents.end());
+            dependent.dependents.clear();
+        }
+    }
+
+    void invalidate_locked() noexcept
+    {
+        for (entry& e : entries_)
+        {
+            if (e.status == state::resolved)
+            {
+                e.status = state::unresolved;
+                ++e.generation;
+            }
+            e.dependents.clear();
+        }
+        for (std::vector<edge>& list : dirent_dependents_)
+        {
+            list.clear();
+        }
+    }
+
+    [[nodiscard]] int watch_locked(id_type dir)
+    {
+        if (watches_[dir] < 0)
+        {
+            // The watch may already be mapped to another path of the same
+            // inode: a bind mount of the directory, or its old path if it
+            // moved before its events were applied.  Events are applied to
+            // every path, and a stale one is dropped by the event its
+            // parent gets for the move.
+            const int wd = ::inotify_add_watch(fd_, results_[dir].c_str(), watch_mask);
+            if (wd >= 0)
+            {
+                watches_[dir] = wd;
+                watched_dirs_.emplace(wd, dir);
+            }
+            return wd;
+        }
+        return watches_[dir];
+    }
+
+    // Unmaps one path from its watch, and removes the watch if remove is
+    // set and no other path shares it.
+    void forget_watch(std::unordered_multimap<int, id_type>::iterator it, bool remove)
+    {
+        const int wd = it->first;
+        watches_[it->second] = -1;
+        watched_dirs_.erase(it);
+        if (remove && watched_dirs_.find(wd) == watched_dirs_.end())
+        {
+            ::inotify_rm_watch(fd_, wd);
+        }
+    }
+
+    // Invalidates the entries that looked up the canonical path dir, and
+    // so everything resolved through that directory.
+    void invalidate_directory(id_type dir)
+    {
+        const string_table::find_result found = dirents_.find(results_[dir]);
+        if (found.is_ok())
+        {
+            invalidate_dependents(dirent_dependents_[found.value()]);
+        }
+    }
+
+    // Removes the watches of path and the directories below it, which no
+    // longer have the paths they are known by.  Only the moved directory
+    // itself is told that it moved.
+    void forget_watches_below(std::string_view path)
+    {
+        for (auto it = watched_dirs_.begin(); it != watched_dirs_.end();)
+        {
+            const std::string_view dir = results_[it->second].view();
+            const auto next = std::next(it);
+            if (dir.substr(0, path.size()) == path && (dir.size() == path.size() || dir[path.size()] == '/'))
+            {
+                forget_watch(it, true);
+            }
+            it = next;
+        }
+    }
+
+    void apply_event(const inotify_event& event)
+    {
+        if (event.mask & (IN_Q_OVERFLOW | IN_UNMOUNT))
+        {
+            // Events were lost, or a file system went away under a watch.
+            invalidate_locked();
+            return;
+        }
+        const auto dirs = watched_dirs_.equal_range(event.wd);
+        if (dirs.first == dirs.second)
+        {
+            return;
+        }
+        if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+        {
+            // The directory no longer has the paths it was known by, so its
+            // watch must not be reused if another one takes them, and
+            // nothing watches what was resolved through them any more.
+            for (auto it = dirs.first; it != dirs.second;)
+            {
+                invalidate_directory(it->second);
+                watches_[it->second] = -1;
+                it = watched_dirs_.erase(it);
+            }
+            if (event.mask & IN_MOVE_SELF)
+            {
+                ::inotify_rm_watch(fd_, event.wd);
+            }
+            return;
+        }
+        const bounded_safe_string name = event_name(event);
+        if (name.length() == 0)
+        {
+            return;
+        }
+        // Forgetting the watches below a moved directory may unmap paths of
+        // this watch, so the child paths are built first.
+        std::vector<std::string> paths;
+        for (auto it = dirs.first; it != dirs.second; ++it)
+        {
+            paths.push_back(child_path(results_[it->second].view(), name.view()));
+        }
+        for (const std::string& path : paths)
+        {
+            if ((event.mask & (IN_MOVED_FROM | IN_ISDIR)) == (IN_MOVED_FROM | IN_ISDIR))
+            {
+                forget_watches_below(path);
+            }
+            const string_table::find_result found = dirents_.find(path.c_str());
+            if (found.is_ok())
+            {
+                invalidate_dependents(dirent_dependents_[found.value()]);
+            }
+        }
+    }
+
+    std::size_t process_events_locked()
+    {
+        std::size_t count = 0;
+        alignas(inotify_event) unsigned char buffer[16384];
+        for (;;)
+        {
+            const ssize_t n = ::read(fd_, buffer, sizeof(buffer));
+            if (n <= 0)
+            {
+                if (n < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                return count;
+            }
+            for (const inotify_event& event : inotify_event_range(buffer, static_cast<std::size_t>(n)))
+            {
+                apply_event(event);
+                ++count;
+            }
+        }
+    }
+
+    void set_resolved(id_type id, int error, id_type result, bool directory)
+    {
+        entry& e    = entries_[id];
+        e.status    = state::resolved;
+        e.error     = error;
+        e.result    = result;
+        e.directory = directory;
+    }
+
+    // Resolves the last component of key, whose entry is id, once its
+    // parent has been resolved.  Returns false if the outcome must not be
+    // cached.
+    [[nodiscard]] bool resolve_step(const std::string& key, id_type id, int links)
+    {
+        if (key.size() > 1 && key.back() == '/')
+        {
+            // "dir/" is "dir", which must be a directory.
+            std::string base = key;
+            while (base.size() > 1 && base.back() == '/')
+            {
+                base.pop_back();
+            }
+            const id_type b = resolve_locked(base, links);
+            if (b == npos)
+            {
+                return false;
+            }
+            const entry& be = entries_[b];
+            set_resolved(id, be.error != 0 ? be.error : be.directory ? 0 : ENOTDIR, be.result, be.directory);
+            add_dependent(entries_[b].dependents, id);
+            return true;
+        }
+        if (key == "/")
+        {
+            set_resolved(id, 0, intern_result("/"), true);
+            return true;
+        }
+
+        const std::string_view name = path_basename(key.c_str());
+        const id_type p = resolve_locked(std::string(path_dirname(key.c_str())), links);
+        if (p == npos)
+        {
+            return false;
+        }
+        const int     parent_error = entries_[p].error;
+        const id_type parent_dir   = entries_[p].result;
+        if (parent_error != 0 || !entries_[p].directory)
+        {
+            set_resolved(id, parent_error != 0 ? parent_error : ENOTDIR, npos, false);
+            add_dependent(entries_[p].dependents, id);
+            return true;
+        }
+        if (name == "." || name == "..")
+        {
+            const id_type result
+                = name == "." ? parent_dir : intern_result(std::string(path_dirname(results_[parent_dir])).c_str());
+            set_resolved(id, 0, result, true);
+            add_dependent(entries_[p].dependents, id);
+            return true;
+        }
+
+        const std::string path = child_path(results_[parent_dir].view(), name);
+        if (path.size() >= PATH_MAX)
+        {
+            set_resolved(id, ENAMETOOLONG, npos, false);
+            add_dependent(entries_[p].dependents, id);
+            return true;
+        }
+        // Watch before looking, so that no change after the lstat() is missed.
+        if (watch_locked(parent_dir) < 0)
+        {
+            return false;
+        }
+        const id_type dirent = dirents_.intern(path.c_str());
+        if (dirent == dirent_dependents_.size())
+        {
+            dirent_dependents_.emplace_back();
+        }
+
+        struct stat st;
+        if (::lstat(path.c_str(), &st) != 0)
+        {
+            const int error = errno;
+            if (!cacheable_error(error))
+            {
+                return false;
+            }
+            set_resolved(id, error, npos, false);
+        }
+        else if (S_ISLNK(st.st_mode))
+        {
+            char target[PATH_MAX];
+            const ssize_t length = ::readlink(path.c_str(), target, sizeof(target));
+            if (length < 0 || static_cast<std::size_t>(length) >= sizeof(target))
+            {
+                return false;
+            }
+            const std::string_view link(target, static_cast<std::size_t>(length));
+            const id_type t = resolve_locked(link.size() != 0 && link[0] == '/'
+                                                 ? std::string(link)
+                                                 : child_path(results_[parent_dir].view(), link),
+                                             links + 1);
+            if (t == npos)
+            {
+                return false;
+            }
+            set_resolved(id, entries_[t].error, entries_[t].result, entries_[t].directory);
+            add_dependent(entries_[t].dependents, id);
+        }
+        else
+        {
+            set_resolved(id, 0, intern_result(path.c_str()), S_ISDIR(st.st_mode));
+        }
+        add_dependent(entries_[p].dependents, id);
+        add_dependent(dirent_dependents_[dirent], id);
+        return true;
+    }
+
+    // Returns the id of key's entry, resolved, or npos if its outcome could
+    // not be cached.  Meeting an entry that is still being resolved means
+    // the symbolic links form a cycle, and its provisional outcome, ELOOP,
+    // is final.  A chain of more than max_links links without a cycle is
+    // left to realpath(), whose count starts at the path it was given.
+    [[nodiscard]] id_type resolve_locked(const std::string& key, int links)
+    {
+        const id_type id = keys_.intern(key.c_str());
+        if (id == entries_.size())
+        {
+            entries_.emplace_back();
+        }
+        if (entries_[id].status != state::unresolved)
+        {
+            return id;
+        }
+        if (links > max_links)
+        {
+            return npos;
+        }
+        set_resolved(id, ELOOP, npos, false);
+        entries_[id].status = state::resolving;
+        if (!resolve_step(key, id, links))
+        {
+            // Entries of a cycle through this one were cached as ELOOP.
+            entry& e = entries_[id];
+            e.status = state::unresolved;
+            ++e.generation;
+            invalidate_dependents(e.dependents);
+            return npos;
+        }
+        return id;
+    }
+
+    [[nodiscard]] realpath_result result_locked(id_type id) const noexcept
+    {
+        const entry& e = entries_[id];
+        return {e.error, e.error == 0 ? results_[e.result] : safe_string()};
+    }
+
+    [[nodiscard]] realpath_result fallback_locked(safe_string path)
+    {
+        char* resolved = ::realpath(path.c_str(), nullptr);
+        if (!resolved)
+        {
+            return {errno, safe_string()};
+        }
+        const id_type id = intern_result(resolved);
+        std::free(resolved);
+        return {0, results_[id]};
+    }
+
+public:
+    // Opens the inotify instance.  If that fails every lookup falls back to
+    // realpath().
+    realpath_cache() : fd_(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {}
+
+    realpath_cache(const realpath_cache& other) = delete;
+    realpath_cache& operator=(const realpath_cache& other) = delete;
+
+    ~realpath_cache() noexcept
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+        }
+    }
+
+    // The inotify descriptor, readable when process_events() has work, or
+    // -1 if the cache could not open one.
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+    // Returns the canonical form of path, as realpath(path, nullptr) would.
+    [[nodiscard]] realpath_result resolve(safe_string path)
+    {
+        if (path_is_absolute(path))
+        {
+            std::shared_lock<std::shared_mutex> lock(lock_);
+            const string_table::find_result found = keys_.find(path);
+            if (found.is_ok() && entries_[found.value()].status == state::resolved)
+            {
+                return result_locked(found.value());
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        if (fd_ < 0 || !path_is_absolute(path))
+        {
+            return fallback_locked(path);
+        }
+        process_events_locked();
+        const id_type id = resolve_locked(path.c_str(), 0);
+        return id == npos ? fallback_locked(path) : result_locked(id);
+    }
+
+    // Applies pending inotify events without blocking and returns how many
+    // there were.
+    std::size_t process_events()
+    {
+        if (fd_ < 0)
+        {
+            return 0;
+        }
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        return process_events_locked();
+    }
+
+    // Forgets every cached outcome.  Returned paths stay valid.
+    void invalidate()
+    {
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        invalidate_locked();
+    }
+};
+
+} // namespace cinter
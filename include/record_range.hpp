@@ -0,0 +1,179 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+namespace cinter
+{
+
+/*
+record_range iterates, in place, over a buffer of packed variable-length
+records as returned by many C and kernel APIs.  Each record starts with a
+fixed Header followed by a payload; the LengthPolicy describes how long a
+record is and how records are aligned:
+
+    struct my_policy
+    {
+        // Records start at offsets that are multiples of alignment.
+        static constexpr std::size_t alignment = 4;
+
+        // Length of the record in bytes, header included, before padding.
+        static std::size_t record_length(const my_header& h) { return h.size; }
+    };
+
+    for (const my_header& h : cinter::record_range<my_header, my_policy>(buffer, bytes_read))
+    {
+        ...
+    }
+
+No record is copied.  Iteration stops at the end of the buffer or at the first
+record whose header does not fit in the remaining bytes, or whose length is
+smaller than the header or runs past the end of the buffer.  well_formed()
+reports whether the whole buffer was consumed.
+
+The buffer must be aligned for Header, which buffers filled by the kernel
+normally are when declared with alignas(Header).
+*/
+template <typename Header, typename LengthPolicy>
+class record_range
+{
+    const unsigned char* first_;
+    const unsigned char* last_;
+
+    [[nodiscard]] static constexpr std::size_t align_up(std::size_t n) noexcept
+    {
+        constexpr std::size_t a = LengthPolicy::alignment;
+        return (n + a - 1) / a * a;
+    }
+
+    // Start of the record after the (well-formed) one at pos, or last.
+    [[nodiscard]] static const unsigned char* next(const unsigned char* first,
+                                                   const unsigned char* pos,
+                                                   const unsigned char* last) noexcept
+    {
+        const std::size_t length = LengthPolicy::record_length(*reinterpret_cast<const Header*>(pos));
+        const std::size_t offset = align_up(static_cast<std::size_t>(pos - first) + length);
+        return offset < static_cast<std::size_t>(last - first) ? first + offset : last;
+    }
+
+    // Returns pos if a well-formed record starts there, otherwise last.
+    [[nodiscard]] static const unsigned char* check(const unsigned char* pos, const unsigned char* last) noexcept
+    {
+        const std::size_t remaining = static_cast<std::size_t>(last - pos);
+        if (remaining < sizeof(Header))
+        {
+            return last;
+        }
+        const std::size_t length = LengthPolicy::record_length(*reinterpret_cast<const Header*>(pos));
+        return length < sizeof(Header) || length > remaining ? last : pos;
+    }
+
+public:
+    class iterator
+    {
+        const unsigned char* first_ = nullptr;
+        const unsigned char* pos_   = nullptr;
+        const unsigned char* last_  = nullptr;
+
+        friend class record_range;
+
+        iterator(const unsigned char* first, const unsigned char* pos, const unsigned char* last) noexcept
+            : first_(first)
+            , pos_(pos)
+            , last_(last)
+        {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Header;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Header*;
+        using reference         = const Header&;
+
+        iterator() noexcept = default;
+
+        [[nodiscard]] reference operator*() const noexcept { return *reinterpret_cast<const Header*>(pos_); }
+        [[nodiscard]] pointer operator->() const noexcept { return reinterpret_cast<const Header*>(pos_); }
+
+        // Payload bytes of the current record, i.e. those after the header.
+        [[nodiscard]] const unsigned char* payload() const noexcept { return pos_ + sizeof(Header); }
+        [[nodiscard]] std::size_t payload_size() const noexcept
+        {
+            return LengthPolicy::record_length(**this) - sizeof(Header);
+        }
+
+        iterator& operator++() noexcept
+        {
+            pos_ = check(next(first_, pos_, last_), last_);
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        [[nodiscard]] bool operator==(const iterator& other) const noexcept { return pos_ == other.pos_; }
+        [[nodiscard]] bool operator!=(const iterator& other) const noexcept { return pos_ != other.pos_; }
+    };
+
+    using const_iterator = iterator;
+
+    constexpr record_range() noexcept : first_(nullptr), last_(nullptr) {}
+    record_range(const void* data, std::size_t size) noexcept
+        : first_(static_cast<const unsigned char*>(data))
+        , last_(static_cast<const unsigned char*>(data) + (data ? size : 0))
+    {}
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator(first_, check(first_, last_), last_); }
+    [[nodiscard]] iterator end() const noexcept { return iterator(first_, last_, last_); }
+
+    [[nodiscard]] bool empty() const noexcept { return begin() == end(); }
+
+    // True if every record is well formed and the records (with their
+    // padding) account for the whole buffer.
+    [[nodiscard]] bool well_formed() const noexcept
+    {
+        for (const unsigned char* pos = first_; pos != last_; pos = next(first_, pos, last_))
+        {
+            if (check(pos, last_) != pos)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace cinter
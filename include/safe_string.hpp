@@ -29,13 +29,126 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #pragma once
+// Expands to `export` when the header is compiled as part of the cinter
+// module (modules/cinter.cppm).
+#ifndef CINTER_EXPORT
+#define CINTER_EXPORT
+#endif
 #include <cstddef>
 #include <type_traits>
+// The headers test feature macros such as __cpp_lib_ranges and
+// __cpp_lib_span, which <version> defines, before including the headers
+// they guard.
+#if __has_include(<version>)
+#include <version>
+#endif
+// In lean mode (see sentinel_result.hpp) <string> is not included.  Every
+// standard library declares std::basic_string in <string_view>, which is
+// enough for the declarations below; code calling string() or converting
+// to std::basic_string must include <string> itself.
+#ifndef CINTER_LEAN_HEADERS
 #include <string>
+#endif
 #include <string_view>
 
-namespace cinter
+CINTER_EXPORT namespace cinter
+{
+
+namespace detail
+{
+
+// Character types with a std::char_traits specialization, and hence a
+// usable std::basic_string_view.
+template <typename Char>
+inline constexpr bool has_char_traits = std::is_same_v<Char, char> || std::is_same_v<Char, wchar_t>
+#ifdef __cpp_char8_t
+                                        || std::is_same_v<Char, char8_t>
+#endif
+                                        || std::is_same_v<Char, char16_t> || std::is_same_v<Char, char32_t>;
+
+// Types through which any object may be read without breaking aliasing
+// rules, and hence targets of basic_safe_string::as().
+template <typename Char>
+inline constexpr bool is_aliasing_byte = std::is_same_v<Char, char> || std::is_same_v<Char, unsigned char>
+                                         || std::is_same_v<Char, std::byte>;
+
+template <typename Char>
+[[nodiscard]] constexpr std::size_t string_length(const Char* s) noexcept
+{
+    if constexpr (has_char_traits<Char>)
+    {
+        return std::char_traits<Char>::length(s);
+    }
+    else
+    {
+        std::size_t len = 0;
+        while (s[len] != Char{})
+        {
+            ++len;
+        }
+        return len;
+    }
+}
+
+} // namespace detail
+
+// End of a null terminated character sequence.  A pointer compares equal
+// to it when it points at the terminator, so iterating from begin() to a
+// null_terminator_sentinel stops at the terminator without first
+// computing the length.
+struct null_terminator_sentinel
+{
+    template <typename Char>
+    [[nodiscard]] friend constexpr bool operator==(const Char* it, null_terminator_sentinel) noexcept
+    {
+        return *it == Char{};
+    }
+
+    template <typename Char>
+    [[nodiscard]] friend constexpr bool operator==(null_terminator_sentinel, const Char* it) noexcept
+    {
+        return *it == Char{};
+    }
+
+    template <typename Char>
+    [[nodiscard]] friend constexpr bool operator!=(const Char* it, null_terminator_sentinel) noexcept
+    {
+        return *it != Char{};
+    }
+
+    template <typename Char>
+    [[nodiscard]] friend constexpr bool operator!=(null_terminator_sentinel, const Char* it) noexcept
+    {
+        return *it != Char{};
+    }
+};
+
+// A null terminated string whose length has been computed, as returned by
+// basic_safe_string::sized().  end() is a pointer, so it works with
+// algorithms that need a common iterator type or the size up front, and
+// c_str() still points at a terminated string.
+template <typename Char = char>
+class basic_sized_safe_string
 {
+    const Char* ptr;
+    std::size_t len;
+
+public:
+    constexpr basic_sized_safe_string(const Char* src, std::size_t length) noexcept : ptr(src), len(length) {}
+
+    [[nodiscard]] constexpr const Char* c_str() const noexcept {return ptr;}
+    [[nodiscard]] constexpr const Char* data() const noexcept {return ptr;}
+    [[nodiscard]] constexpr std::size_t size() const noexcept {return len;}
+    [[nodiscard]] constexpr bool empty() const noexcept {return len == 0;}
+    [[nodiscard]] constexpr std::basic_string_view<Char> view() const noexcept {return {ptr, len};}
+
+    using const_iterator = const Char*;
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return ptr; }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return ptr + len; }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+};
 
 // basic_safe_string wraps a pointer to character array (a C-string)
 // that treats null pointers as empty strings.  operator bool and
@@ -46,48 +159,31 @@ class basic_safe_string
 {
     const Char* ptr;
 
-    [[nodiscard]] static constexpr const Char* empty_string()
+    // Returned by c_str() for a null pointer.  Every character type has
+    // one, including unsigned char and std::byte.
+    static constexpr Char terminator{};
+
+    [[nodiscard]] constexpr int compare(const basic_safe_string& other) const noexcept
     {
-        if constexpr (std::is_same_v<Char, char>)
-        {
-            return "";
-        }
-        else if constexpr (std::is_same_v<Char, wchar_t>)
-        {
-            return L"";
-        }
-#ifdef __cpp_char8_t
-        else if constexpr (std::is_same_v<Char, char8_t>)
-        {
-            return u8"";
-        }
-#endif
-        else if constexpr (std::is_same_v<Char, char16_t>)
-        {
-            return u"";
-        }
-        else if constexpr (std::is_same_v<Char, char32_t>)
+        if constexpr (detail::has_char_traits<Char>)
         {
-            return U"";
+            return view().compare(other.view());
         }
         else
         {
-            return nullptr;
+            const Char* a = c_str();
+            const Char* b = other.c_str();
+            for (; *a == *b; ++a, ++b)
+            {
+                if (*a == Char{})
+                {
+                    return 0;
+                }
+            }
+            return *a < *b ? -1 : 1;
         }
     }
 
-    // Used to implement end()
-    [[nodiscard]] constexpr std::size_t length() const
-    {
-        const Char* s = c_str();
-        std::size_t len = 0;
-        while (s[len] != Char{})
-        {
-            ++len;
-        }
-        return len;
-    }
-
 public:
     constexpr basic_safe_string() noexcept : ptr(nullptr) {}
     // Implicit conversion is desired
@@ -103,19 +199,42 @@ public:
 
     [[nodiscard]] constexpr bool is_null() const {return !ptr;}
     [[nodiscard]] explicit constexpr operator bool() const {return ptr != nullptr;}
-    [[nodiscard]] constexpr const Char* c_str() const {return ptr ? ptr : empty_string();}
+    [[nodiscard]] constexpr const Char* c_str() const {return ptr ? ptr : &terminator;}
 
+    // string() and view() need std::char_traits<Char>, which the standard
+    // only provides for char, wchar_t and the charN_t types.  For unsigned
+    // char, signed char or std::byte, use as<char>().view().
     [[nodiscard]] std::basic_string<Char> string() const {return c_str();}
     [[nodiscard]] explicit operator std::basic_string<Char>() const {return c_str();}
 
     [[nodiscard]] constexpr std::basic_string_view<Char> view() const {return c_str();}
     [[nodiscard]] explicit constexpr operator std::basic_string_view<Char>() const {return view();}
 
+    // Reinterprets the characters as another one-byte type without copying,
+    // e.g. the unsigned char text from sqlite3_column_text() or libxml2 as a
+    // safe_string.  A null pointer stays null.  To must be char, unsigned
+    // char or std::byte, the types that may read any object.
+    template <typename To>
+    [[nodiscard]] basic_safe_string<To> as() const noexcept
+    {
+        static_assert(sizeof(Char) == 1 && sizeof(To) == 1, "as() converts between one-byte character types");
+        static_assert(detail::is_aliasing_byte<To> || std::is_same_v<To, Char>,
+                      "reading through To would break aliasing rules; convert to char, unsigned char or std::byte");
+        return reinterpret_cast<const To*>(ptr);
+    }
+
     // Visual Studio 2022 does not generate correct results when using the spaceship operator (<=>)
     // to generate the comparison operators. So we stick with defining all comparsion operators manually.
     [[nodiscard]] constexpr bool operator==(const basic_safe_string& other) const noexcept
     {
-        return view() == other.view();
+        if constexpr (detail::has_char_traits<Char>)
+        {
+            return view() == other.view();
+        }
+        else
+        {
+            return compare(other) == 0;
+        }
     }
 
     [[nodiscard]] constexpr bool operator!=(const basic_safe_string& other) const noexcept
@@ -125,35 +244,50 @@ public:
 
     [[nodiscard]] constexpr bool operator<(const basic_safe_string& other) const noexcept
     {
-        return view().compare(other.view()) < 0;
+        return compare(other) < 0;
     }
 
     [[nodiscard]] constexpr bool operator<=(const basic_safe_string& other) const noexcept
     {
-        return view().compare(other.view()) <= 0;
+        return compare(other) <= 0;
     }
 
     [[nodiscard]] constexpr bool operator>(const basic_safe_string& other) const noexcept
     {
-        return view().compare(other.view()) > 0;
+        return compare(other) > 0;
     }
 
     [[nodiscard]] constexpr bool operator>=(const basic_safe_string& other) const noexcept
     {
-        return view().compare(other.view()) >= 0;
+        return compare(other) >= 0;
     }
 
     using const_iterator = const Char*;
+    using sentinel = null_terminator_sentinel;
 
+    // end() is a sentinel rather than begin() + length, so a range-for loop
+    // or an algorithm that stops early never scans the whole string just to
+    // find where it ends.  Use sized() when a pointer end or the size is
+    // needed, e.g. for std::reverse or the C++17 iterator pair algorithms.
     [[nodiscard]] constexpr const_iterator begin() const noexcept { return c_str(); }
-    [[nodiscard]] constexpr const_iterator end() const noexcept { return c_str() + length(); }
+    [[nodiscard]] constexpr sentinel end() const noexcept { return {}; }
     [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
-    [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }    
+    [[nodiscard]] constexpr sentinel cend() const noexcept { return end(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return *c_str() == Char{}; }
+
+    // Computes the length once and returns a sized range over the same
+    // characters.
+    [[nodiscard]] constexpr basic_sized_safe_string<Char> sized() const noexcept
+    {
+        const Char* s = c_str();
+        return {s, detail::string_length(s)};
+    }
 
     // While a constexpr length(), size(), and operator[] could be constructed, they
     // would only be usable from consteval'ed C++ code.  This class is intended to
-    // only wrap C code.  Therefore these member function definitions are private or
-    // deleted.
+    // only wrap C code.  Therefore these member function definitions are deleted;
+    // sized() is the explicit way to pay for the length.
     constexpr std::size_t size() const = delete;
     constexpr const Char& operator[](std::size_t pos) const = delete;
 };
@@ -166,4 +300,20 @@ using safe_u8string = basic_safe_string<char8_t>;
 using safe_u16string = basic_safe_string<char16_t>;
 using safe_u32string = basic_safe_string<char32_t>;
 
+using sized_safe_string  = basic_sized_safe_string<char>;
+using sized_safe_wstring = basic_sized_safe_string<wchar_t>;
+
 } // namespace cinter
+
+#ifdef __cpp_lib_ranges
+// Both types only refer to characters they do not own, so iterators taken
+// from a temporary remain valid.
+namespace std::ranges
+{
+template <typename Char>
+inline constexpr bool enable_borrowed_range<cinter::basic_safe_string<Char>> = true;
+
+template <typename Char>
+inline constexpr bool enable_borrowed_range<cinter::basic_sized_safe_string<Char>> = true;
+} // namespace std::ranges
+#endif
@@ -29,12 +29,60 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #pragma once
+// Expands to `export` when the header is compiled as part of the cinter
+// module (modules/cinter.cppm).
+#ifndef CINTER_EXPORT
+#define CINTER_EXPORT
+#endif
 #include <cstdint>
+// With CINTER_LEAN_HEADERS defined, cinter headers include as little of
+// the standard library as they can.  Code that uses std::less and friends
+// must then include <functional> itself.
+#ifndef CINTER_LEAN_HEADERS
 #include <functional>
+#endif
 
-namespace cinter
+CINTER_EXPORT namespace cinter
 {
 
+// Comparators for sentinel_result that behave like the std:: function
+// objects of the same name but do not need <functional>.
+template <typename T>
+struct equal_to
+{
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const { return lhs == rhs; }
+};
+
+template <typename T>
+struct not_equal_to
+{
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const { return lhs != rhs; }
+};
+
+template <typename T>
+struct less
+{
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const { return lhs < rhs; }
+};
+
+template <typename T>
+struct less_equal
+{
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const { return lhs <= rhs; }
+};
+
+template <typename T>
+struct greater
+{
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const { return lhs > rhs; }
+};
+
+template <typename T>
+struct greater_equal
+{
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const { return lhs >= rhs; }
+};
+
 /*
 Near-zero-overhead (if not zero overhead) wrapper class
 that helps make writing code using OS functions that use
@@ -49,10 +97,13 @@ For example:
 
 Example sentinel_result-based types:
     using SentinelHResult = sentinel_result<HRESULT>;
-    using XenomaiResult   = sentinel_result<int, 0, std::less<int>>;
-    using StringResult    = sentinel_result<const char*, nullptr, std::not_equal_to<const char*>>;  // Consider using cinter::safe_string though
+    using XenomaiResult   = sentinel_result<int, 0, cinter::less<int>>;
+    using StringResult    = sentinel_result<const char*, nullptr, cinter::not_equal_to<const char*>>;  // Consider using cinter::safe_string though
+
+Any comparator works, including those from <functional> such as
+std::less<int>.
 */
-template <typename T, T sentinel = static_cast<T>(0), typename SuccessComp = std::equal_to<T>>
+template <typename T, T sentinel = static_cast<T>(0), typename SuccessComp = equal_to<T>>
 class sentinel_result
 {
     T value_;
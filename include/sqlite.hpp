@@ -0,0 +1,478 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include "string_table.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <sqlite3.h>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Zero-copy SQLite support.  Result codes are sentinel_results, text
+// columns are returned as views of SQLite's own buffers together with the
+// length SQLite already knows, and prepared statements are reused through
+// sqlite_statement_cache.  Link with -lsqlite3.
+
+namespace cinter
+{
+
+// SQLITE_OK on success, otherwise an SQLite result code.
+using sqlite_status = sentinel_result<int, SQLITE_OK>;
+// Result of stepping a query: is_ok() while a row is available.  After the
+// last row value() is SQLITE_DONE; anything else is an error.
+using sqlite_row_result = sentinel_result<int, SQLITE_ROW>;
+// Result of running a statement to completion.
+using sqlite_done_result = sentinel_result<int, SQLITE_DONE>;
+
+// English description of a result code.
+[[nodiscard]] inline safe_string sqlite_error_string(int code) noexcept
+{
+    return sqlite3_errstr(code);
+}
+
+// RAII owner of a prepared statement.
+//
+// Text and blob column values point into SQLite's buffers.  They remain
+// valid until the next step(), reset() or the destruction of the statement.
+// Bound text and blobs are not copied either (SQLITE_STATIC), so they must
+// outlive the statement's use of them, i.e. until it is reset or rebound.
+class sqlite_statement
+{
+    sqlite3_stmt* stmt_ = nullptr;
+
+public:
+    sqlite_statement() noexcept = default;
+
+    // Takes ownership of stmt.
+    explicit sqlite_statement(sqlite3_stmt* stmt) noexcept : stmt_(stmt) {}
+
+    sqlite_statement(sqlite_statement&& other) noexcept : stmt_(std::exchange(other.stmt_, nullptr)) {}
+
+    sqlite_statement& operator=(sqlite_statement&& other) noexcept
+    {
+        if (this != &other)
+        {
+            finalize();
+            stmt_ = std::exchange(other.stmt_, nullptr);
+        }
+        return *this;
+    }
+
+    sqlite_statement(const sqlite_statement& other) = delete;
+    sqlite_statement& operator=(const sqlite_statement& other) = delete;
+
+    ~sqlite_statement() noexcept
+    {
+        finalize();
+    }
+
+    void finalize() noexcept
+    {
+        if (stmt_)
+        {
+            sqlite3_finalize(stmt_);
+            stmt_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] bool is_prepared() const noexcept { return stmt_ != nullptr; }
+    [[nodiscard]] sqlite3_stmt* handle() const noexcept { return stmt_; }
+
+    [[nodiscard]] sqlite3_stmt* release() noexcept
+    {
+        return std::exchange(stmt_, nullptr);
+    }
+
+    sqlite_row_result step() noexcept
+    {
+        return sqlite3_step(stmt_);
+    }
+
+    // Steps until the statement is done, discarding any rows.
+    sqlite_done_result execute() noexcept
+    {
+        int rc;
+        do
+        {
+            rc = sqlite3_step(stmt_);
+        } while (rc == SQLITE_ROW);
+        return rc;
+    }
+
+    // Rewinds the statement so it can be stepped again.  Bindings are kept.
+    sqlite_status reset() noexcept
+    {
+        return sqlite3_reset(stmt_);
+    }
+
+    sqlite_status clear_bindings() noexcept
+    {
+        return sqlite3_clear_bindings(stmt_);
+    }
+
+    // Parameters are numbered from 1.
+    template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, int> = 0>
+    sqlite_status bind(int index, Integer value) noexcept
+    {
+        return sqlite3_bind_int64(stmt_, index, static_cast<sqlite3_int64>(value));
+    }
+
+    sqlite_status bind(int index, double value) noexcept
+    {
+        return sqlite3_bind_double(stmt_, index, value);
+    }
+
+    sqlite_status bind(int index, std::nullptr_t) noexcept
+    {
+        return sqlite3_bind_null(stmt_, index);
+    }
+
+    // A null safe_string binds an empty string, not NULL.
+    sqlite_status bind(int index, safe_string value) noexcept
+    {
+        return sqlite3_bind_text(stmt_, index, value.c_str(), -1, SQLITE_STATIC);
+    }
+
+    sqlite_status bind(int index, const char* value) noexcept
+    {
+        return bind(index, safe_string(value));
+    }
+
+    sqlite_status bind(int index, std::string_view value) noexcept
+    {
+        return sqlite3_bind_text64(stmt_, index, value.data(), value.size(), SQLITE_STATIC, SQLITE_UTF8);
+    }
+
+    sqlite_status bind_blob(int index, const void* data, std::size_t size) noexcept
+    {
+        return sqlite3_bind_blob64(stmt_, index, data, size, SQLITE_STATIC);
+    }
+
+    [[nodiscard]] int column_count() const noexcept { return sqlite3_column_count(stmt_); }
+    [[nodiscard]] safe_string column_name(int column) const noexcept { return sqlite3_column_name(stmt_, column); }
+
+    // SQLITE_INTEGER, SQLITE_FLOAT, SQLITE_TEXT, SQLITE_BLOB or SQLITE_NULL.
+    // Columns are numbered from 0.
+    [[nodiscard]] int column_type(int column) const noexcept { return sqlite3_column_type(stmt_, column); }
+    [[nodiscard]] bool column_is_null(int column) const noexcept { return column_type(column) == SQLITE_NULL; }
+
+    [[nodiscard]] std::int64_t column_int64(int column) const noexcept
+    {
+        return sqlite3_column_int64(stmt_, column);
+    }
+
+    [[nodiscard]] double column_double(int column) const noexcept
+    {
+        return sqlite3_column_double(stmt_, column);
+    }
+
+    // The text of a column, without copying it or scanning for its length:
+    // the size comes from sqlite3_column_bytes.  NULL is an empty string.
+    [[nodiscard]] sized_safe_string column_text(int column) const noexcept
+    {
+        // sqlite3_column_text must come first: it may convert the value,
+        // which changes what sqlite3_column_bytes reports.
+        const basic_safe_string<unsigned char> text = sqlite3_column_text(stmt_, column);
+        const int bytes = sqlite3_column_bytes(stmt_, column);
+        return {text.as<char>().c_str(), static_cast<std::size_t>(bytes)};
+    }
+
+    [[nodiscard]] std::string_view column_blob(int column) const noexcept
+    {
+        const void* data = sqlite3_column_blob(stmt_, column);
+        const int bytes = sqlite3_column_bytes(stmt_, column);
+        return data ? std::string_view(static_cast<const char*>(data), static_cast<std::size_t>(bytes)) : std::string_view();
+    }
+};
+
+// RAII owner of a database connection.
+class sqlite_database
+{
+    sqlite3* db_ = nullptr;
+
+public:
+    sqlite_database() noexcept = default;
+
+    sqlite_database(sqlite_database&& other) noexcept : db_(std::exchange(other.db_, nullptr)) {}
+
+    sqlite_database& operator=(sqlite_database&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            db_ = std::exchange(other.db_, nullptr);
+        }
+        return *this;
+    }
+
+    sqlite_database(const sqlite_database& other) = delete;
+    sqlite_database& operator=(const sqlite_database& other) = delete;
+
+    ~sqlite_database() noexcept
+    {
+        close();
+    }
+
+    // Opens filename, or a private in-memory database for ":memory:".  On
+    // failure the connection stays closed; describe the code with
+    // sqlite_error_string().
+    sqlite_status open(safe_string filename, int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) noexcept
+    {
+        close();
+        const int rc = sqlite3_open_v2(filename.c_str(), &db_, flags, nullptr);
+        if (rc != SQLITE_OK)
+        {
+            close();
+        }
+        return rc;
+    }
+
+    // Statements that are still alive keep the connection open until they
+    // are finalized (sqlite3_close_v2).
+    void close() noexcept
+    {
+        if (db_)
+        {
+            sqlite3_close_v2(db_);
+            db_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return db_ != nullptr; }
+    [[nodiscard]] sqlite3* handle() const noexcept { return db_; }
+
+    // Message for the most recent failure on this connection.
+    [[nodiscard]] safe_string error_message() const noexcept { return sqlite3_errmsg(db_); }
+
+    // Runs one or more statements that return no rows.
+    sqlite_status exec(safe_string sql) noexcept
+    {
+        return sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr);
+    }
+
+    sqlite_status prepare(safe_string sql, sqlite_statement& out) const noexcept
+    {
+        sqlite3_stmt* stmt = nullptr;
+        const int rc = sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr);
+        out = sqlite_statement(stmt);
+        return rc;
+    }
+
+    [[nodiscard]] std::int64_t changes() const noexcept { return sqlite3_changes(db_); }
+    [[nodiscard]] std::int64_t last_insert_rowid() const noexcept { return sqlite3_last_insert_rowid(db_); }
+};
+
+class sqlite_statement_cache;
+
+// A statement borrowed from a sqlite_statement_cache.  When the lease ends
+// the statement is reset, its bindings are cleared and it goes back to the
+// cache.
+class sqlite_statement_lease
+{
+    friend class sqlite_statement_cache;
+
+    using id_type = string_table::id_type;
+
+    sqlite_statement_cache* cache_ = nullptr;
+    id_type                 id_ = 0;
+    // Used instead of a cached statement when the cache is full or the
+    // cached one is already leased.
+    sqlite_statement        owned_;
+
+public:
+    sqlite_statement_lease() noexcept = default;
+
+    sqlite_statement_lease(sqlite_statement_lease&& other) noexcept
+        : cache_(std::exchange(other.cache_, nullptr))
+        , id_(other.id_)
+        , owned_(std::move(other.owned_))
+    {}
+
+    sqlite_statement_lease& operator=(sqlite_statement_lease&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            cache_ = std::exchange(other.cache_, nullptr);
+            id_    = other.id_;
+            owned_ = std::move(other.owned_);
+        }
+        return *this;
+    }
+
+    sqlite_statement_lease(const sqlite_statement_lease& other) = delete;
+    sqlite_statement_lease& operator=(const sqlite_statement_lease& other) = delete;
+
+    ~sqlite_statement_lease() noexcept
+    {
+        release();
+    }
+
+    // Returns the statement early.
+    inline void release() noexcept;
+
+    [[nodiscard]] inline sqlite_statement& statement() noexcept;
+    [[nodiscard]] sqlite_statement& operator*() noexcept { return statement(); }
+    [[nodiscard]] sqlite_statement* operator->() noexcept { return &statement(); }
+};
+
+/*
+sqlite_statement_cache keeps prepared statements for one connection, keyed
+by the text of their SQL, so a hot query is compiled once instead of on
+every call.  The SQL text is interned in a string_table; a lookup hashes
+the key in the same pass that finds its terminator.
+
+    cinter::sqlite_statement_cache cache(db.handle());
+    cinter::sqlite_statement_lease q;
+    if (cache.acquire("SELECT name FROM users WHERE id = ?", q).is_ok())
+    {
+        q->bind(1, id);
+        while (q->step().is_ok())
+        {
+            std::string_view name = q->column_text(0).view();
+        }
+    }
+
+At most capacity() distinct statements are cached; SQL beyond that is
+prepared and finalized per lease.  Like the connection it serves, a cache
+must only be used by one thread at a time, and it must be destroyed before
+the connection is closed.
+*/
+class sqlite_statement_cache
+{
+    friend class sqlite_statement_lease;
+
+    struct slot
+    {
+        sqlite_statement statement;
+        bool             leased = false;
+    };
+
+    sqlite3*         db_;
+    std::size_t      capacity_;
+    string_table     sql_;
+    // A deque, so that adding a slot does not move the statements that
+    // leases have handed out references to.
+    std::deque<slot> slots_;
+
+    [[nodiscard]] sqlite_status prepare(safe_string sql, std::size_t length, sqlite_statement& out, bool persistent) const noexcept
+    {
+        sqlite3_stmt* stmt = nullptr;
+        // Passing the length including the terminator saves SQLite a copy.
+        const int bytes = static_cast<int>(length + 1);
+#if SQLITE_VERSION_NUMBER >= 3020000
+        const int rc = sqlite3_prepare_v3(db_, sql.c_str(), bytes, persistent ? SQLITE_PREPARE_PERSISTENT : 0, &stmt, nullptr);
+#else
+        (void)persistent;
+        const int rc = sqlite3_prepare_v2(db_, sql.c_str(), bytes, &stmt, nullptr);
+#endif
+        out = sqlite_statement(stmt);
+        // SQL that is empty or only whitespace and comments prepares to no
+        // statement at all; a lease must always hold one.
+        return rc == SQLITE_OK && !stmt ? SQLITE_MISUSE : rc;
+    }
+
+    void give_back(string_table::id_type id) noexcept
+    {
+        slot& s = slots_[id];
+        (void)s.statement.reset();
+        (void)s.statement.clear_bindings();
+        s.leased = false;
+    }
+
+public:
+    explicit sqlite_statement_cache(sqlite3* db, std::size_t capacity = 256) : db_(db), capacity_(capacity) {}
+
+    sqlite_statement_cache(const sqlite_statement_cache& other) = delete;
+    sqlite_statement_cache& operator=(const sqlite_statement_cache& other) = delete;
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] std::size_t size() const noexcept { return slots_.size(); }
+
+    // Leases the statement for sql, preparing it if it is not cached yet.
+    // On failure out is left empty.  SQL that contains no statement fails
+    // with SQLITE_MISUSE and is not cached.
+    sqlite_status acquire(safe_string sql, sqlite_statement_lease& out)
+    {
+        out.release();
+        string_table::find_result found = sql_.find(sql);
+        if (!found.is_ok())
+        {
+            const std::size_t length = sql.sized().size();
+            if (slots_.size() == capacity_)
+            {
+                return prepare(sql, length, out.owned_, false);
+            }
+            // SQL is only interned once it has prepared, so a statement
+            // that fails does not take a slot for good.  SQLite keeps its
+            // own copy of the text.
+            sqlite_statement statement;
+            const sqlite_status rc = prepare(sql, length, statement, true);
+            if (rc.has_error())
+            {
+                return rc;
+            }
+            found = sql_.intern(sql);
+            slots_.push_back({std::move(statement)});
+        }
+
+        const string_table::id_type id = found.value();
+        slot& s = slots_[id];
+        if (s.leased)
+        {
+            return prepare(sql, sql_.length(id), out.owned_, false);
+        }
+        s.leased   = true;
+        out.cache_ = this;
+        out.id_    = id;
+        return SQLITE_OK;
+    }
+};
+
+inline void sqlite_statement_lease::release() noexcept
+{
+    if (cache_)
+    {
+        std::exchange(cache_, nullptr)->give_back(id_);
+    }
+    owned_.finalize();
+}
+
+inline sqlite_statement& sqlite_statement_lease::statement() noexcept
+{
+    return cache_ ? cache_->slots_[id_].statement : owned_;
+}
+
+} // namespace cinter
@@ -0,0 +1,357 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "hash.hpp"
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#include <stdexcept>
+#include <vector>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+
+namespace cinter
+{
+
+// basic_string_table interns C-strings: each distinct string is copied once
+// into chunked storage and identified by a dense 32-bit id.  Storage never
+// moves, so the basic_safe_string returned by operator[] stays valid for the
+// lifetime of the table and can be passed straight back to C APIs.
+//
+// Lookups take a basic_safe_string and hash it in the same pass that finds
+// its terminator.  find_batch() looks up many keys at once, software
+// prefetching the key characters and the table slots several keys ahead so
+// that the cache misses of different keys overlap.
+template <typename Char = char, typename Allocator = std::allocator<Char>>
+class basic_string_table
+{
+public:
+    using char_type      = Char;
+    using allocator_type = Allocator;
+    using id_type        = std::uint32_t;
+
+    static constexpr id_type npos = static_cast<id_type>(-1);
+
+    using find_result = sentinel_result<id_type, npos, not_equal_to<id_type>>;
+
+private:
+    struct entry
+    {
+        const Char*   str;
+        std::size_t   length;
+        std::uint64_t hash;
+    };
+
+    // id == npos marks an empty slot.  tag holds the upper hash bits so most
+    // mismatches are rejected without touching the string, and str lets a
+    // probe compare the string without first loading its entry.
+    struct slot
+    {
+        const Char*   str;
+        id_type       id;
+        std::uint32_t tag;
+    };
+
+    struct chunk
+    {
+        Char*       data;
+        std::size_t capacity;
+    };
+
+    using char_alloc_traits = std::allocator_traits<Allocator>;
+    using entry_allocator   = typename char_alloc_traits::template rebind_alloc<entry>;
+    using slot_allocator    = typename char_alloc_traits::template rebind_alloc<slot>;
+    using chunk_allocator   = typename char_alloc_traits::template rebind_alloc<chunk>;
+
+    static constexpr std::size_t chunk_chars = 64 * 1024 / sizeof(Char);
+    static constexpr std::size_t min_slots   = 16;
+
+    Allocator                           alloc_;
+    std::vector<chunk, chunk_allocator> chunks_;
+    std::vector<entry, entry_allocator> entries_;
+    std::vector<slot, slot_allocator>   slots_;
+    std::size_t                         chunk_used_ = 0;
+
+    [[nodiscard]] static std::uint32_t tag_of(std::uint64_t hash) noexcept
+    {
+        return static_cast<std::uint32_t>(hash >> 32);
+    }
+
+    [[nodiscard]] id_type probe(const Char* key, const hashed_length& hl) const noexcept
+    {
+        if (slots_.empty())
+        {
+            return npos;
+        }
+        const std::size_t   mask = slots_.size() - 1;
+        const std::uint32_t tag  = tag_of(hl.hash);
+        for (std::size_t i = static_cast<std::size_t>(hl.hash) & mask;; i = (i + 1) & mask)
+        {
+            const slot& s = slots_[i];
+            if (s.id == npos)
+            {
+                return npos;
+            }
+            // The stored length is checked first, so the comparison never
+            // reads past the terminator of a shorter string.
+            if (s.tag == tag && entries_[s.id].length == hl.length
+                && std::memcmp(key, s.str, hl.length * sizeof(Char)) == 0)
+            {
+                return s.id;
+            }
+        }
+    }
+
+    void place(id_type id, const Char* str, std::uint64_t hash) noexcept
+    {
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t       i    = static_cast<std::size_t>(hash) & mask;
+        while (slots_[i].id != npos)
+        {
+            i = (i + 1) & mask;
+        }
+        slots_[i] = slot{str, id, tag_of(hash)};
+    }
+
+    void rehash(std::size_t slot_count)
+    {
+        slots_.assign(slot_count, slot{nullptr, npos, 0});
+        for (std::size_t id = 0; id < entries_.size(); ++id)
+        {
+            place(static_cast<id_type>(id), entries_[id].str, entries_[id].hash);
+        }
+    }
+
+    [[nodiscard]] const Char* store(const Char* src, std::size_t length)
+    {
+        const std::size_t needed = length + 1;
+        if (chunks_.empty() || chunks_.back().capacity - chunk_used_ < needed)
+        {
+            typename char_alloc_traits::template rebind_alloc<Char> char_alloc(alloc_);
+            const std::size_t capacity = std::max(chunk_chars, needed);
+            chunks_.reserve(chunks_.size() + 1);
+            chunks_.push_back(chunk{std::allocator_traits<decltype(char_alloc)>::allocate(char_alloc, capacity),
+                                    capacity});
+            chunk_used_ = 0;
+        }
+        Char* dst = chunks_.back().data + chunk_used_;
+        std::copy(src, src + length, dst);
+        dst[length] = Char{};
+        chunk_used_ += needed;
+        return dst;
+    }
+
+    void release() noexcept
+    {
+        typename char_alloc_traits::template rebind_alloc<Char> char_alloc(alloc_);
+        for (const chunk& c : chunks_)
+        {
+            std::allocator_traits<decltype(char_alloc)>::deallocate(char_alloc, c.data, c.capacity);
+        }
+        chunks_.clear();
+    }
+
+public:
+    basic_string_table() : basic_string_table(Allocator{}) {}
+
+    explicit basic_string_table(const Allocator& alloc)
+        : alloc_(alloc)
+        , chunks_(chunk_allocator(alloc))
+        , entries_(entry_allocator(alloc))
+        , slots_(slot_allocator(alloc))
+    {}
+
+    basic_string_table(basic_string_table&& other) noexcept
+        : alloc_(other.alloc_)
+        , chunks_(std::move(other.chunks_))
+        , entries_(std::move(other.entries_))
+        , slots_(std::move(other.slots_))
+        , chunk_used_(other.chunk_used_)
+    {
+        other.chunks_.clear();
+        other.entries_.clear();
+        other.slots_.clear();
+        other.chunk_used_ = 0;
+    }
+
+    basic_string_table(const basic_string_table& other) = delete;
+    basic_string_table& operator=(const basic_string_table& other) = delete;
+    basic_string_table& operator=(basic_string_table&& other) = delete;
+
+    ~basic_string_table() noexcept
+    {
+        release();
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return alloc_; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+    void reserve(std::size_t count)
+    {
+        entries_.reserve(count);
+        std::size_t slot_count = min_slots;
+        while (slot_count < count * 2)
+        {
+            slot_count *= 2;
+        }
+        if (slot_count > slots_.size())
+        {
+            rehash(slot_count);
+        }
+    }
+
+    // Returns the id of key, copying it into the table if it is not present.
+    // A null key is interned as the empty string.
+    id_type intern(basic_safe_string<Char> key)
+    {
+        const Char*         str = key.c_str();
+        const hashed_length hl  = hash_with_length(key);
+        const id_type       found = probe(str, hl);
+        if (found != npos)
+        {
+            return found;
+        }
+        if (entries_.size() >= npos - 1)
+        {
+            throw std::length_error("cinter::basic_string_table: too many strings");
+        }
+        if ((entries_.size() + 1) * 2 > slots_.size())
+        {
+            rehash(slots_.empty() ? min_slots : slots_.size() * 2);
+        }
+        const id_type id = static_cast<id_type>(entries_.size());
+        const Char*   copy = store(str, hl.length);
+        entries_.push_back(entry{copy, hl.length, hl.hash});
+        place(id, copy, hl.hash);
+        return id;
+    }
+
+    [[nodiscard]] find_result find(basic_safe_string<Char> key) const noexcept
+    {
+        return probe(key.c_str(), hash_with_length(key));
+    }
+
+    [[nodiscard]] bool contains(basic_safe_string<Char> key) const noexcept
+    {
+        return find(key).is_ok();
+    }
+
+    // Looks up keys[0..count) and writes their ids (or npos) to out[0..count).
+    // The loop runs four stages over a sliding window, each working
+    // batch_prefetch_distance keys behind the previous one: prefetch the key
+    // characters; hash the key and prefetch its home slot; prefetch the
+    // string stored in that slot; probe.  The misses on keys, slots and
+    // stored strings of different keys are then in flight at the same time.
+    void find_batch(const basic_safe_string<Char>* keys, std::size_t count, id_type* out) const noexcept
+    {
+        constexpr std::size_t distance = batch_prefetch_distance;
+        constexpr std::size_t ring     = 4 * distance;
+        hashed_length         pending[ring];
+
+        if (slots_.empty())
+        {
+            std::fill(out, out + count, npos);
+            return;
+        }
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = 0; i < count + 3 * distance; ++i)
+        {
+            if (i < count)
+            {
+                detail::prefetch(keys[i].c_str());
+            }
+            if (i >= distance && i - distance < count)
+            {
+                const std::size_t j = i - distance;
+                pending[j % ring]   = hash_with_length(keys[j]);
+                detail::prefetch(&slots_[static_cast<std::size_t>(pending[j % ring].hash) & mask]);
+            }
+            if (i >= 2 * distance && i - 2 * distance < count)
+            {
+                const std::size_t j = i - 2 * distance;
+                const slot&       s = slots_[static_cast<std::size_t>(pending[j % ring].hash) & mask];
+                if (s.id != npos && s.tag == tag_of(pending[j % ring].hash))
+                {
+                    detail::prefetch(s.str);
+                }
+            }
+            if (i >= 3 * distance)
+            {
+                const std::size_t k = i - 3 * distance;
+                out[k]              = probe(keys[k].c_str(), pending[k % ring]);
+            }
+        }
+    }
+
+#ifdef __cpp_lib_span
+    void find_batch(std::span<const basic_safe_string<Char>> keys, std::span<id_type> out) const noexcept
+    {
+        find_batch(keys.data(), keys.size() < out.size() ? keys.size() : out.size(), out.data());
+    }
+#endif
+
+    [[nodiscard]] basic_safe_string<Char> operator[](id_type id) const noexcept { return entries_[id].str; }
+    [[nodiscard]] std::size_t length(id_type id) const noexcept { return entries_[id].length; }
+    [[nodiscard]] std::uint64_t hash(id_type id) const noexcept { return entries_[id].hash; }
+};
+
+using string_table  = basic_string_table<char>;
+using wstring_table = basic_string_table<wchar_t>;
+
+#ifdef __cpp_lib_memory_resource
+namespace pmr
+{
+
+// String tables that take their storage from a std::pmr::memory_resource,
+// such as cinter::hugepage_arena_resource.
+template <typename Char = char>
+using basic_string_table = cinter::basic_string_table<Char, std::pmr::polymorphic_allocator<Char>>;
+
+using string_table  = basic_string_table<char>;
+using wstring_table = basic_string_table<wchar_t>;
+
+} // namespace pmr
+#endif
+
+} // namespace cinter
@@ -0,0 +1,516 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "hash.hpp"
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include "string_table.hpp"
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cinter
+{
+
+/*
+Persistent snapshots of a string_table.  save_snapshot() writes a table to
+a file that string_table_snapshot maps with a single mmap(2); there is
+nothing to parse or rebuild on open, and lookups return safe_strings that
+point into the mapping.  Pages are faulted in as they are used, so a large
+table is usable immediately after a restart.
+
+File layout (native byte order, all offsets relative to the start of the
+file, every section 8-byte aligned):
+
+    snapshot_header
+    entry[string_count]    offset into the blob, length and hash
+    slot[slot_count]       open-addressed index: id and upper hash bits
+    blob                   the strings, each followed by a terminator
+
+The header records a format version, the byte order, the hash function
+and a checksum of everything after it.  open() rejects files written with
+a different byte order or hash, and headers whose sections do not fit the
+file, but by default reads nothing else, so opening costs one mmap and
+the strings are paged in by the lookups that use them.  A file that may
+be corrupt or crafted should be opened with snapshot_verify::contents or
+snapshot_verify::checksum, which check every entry and slot so that
+lookups cannot read out of bounds or loop.
+
+    cinter::save_snapshot(table, "/var/cache/app/strings.snap");
+    ...
+    cinter::string_table_snapshot snap;
+    if (snap.open("/var/cache/app/strings.snap").has_error()) { rebuild(); }
+    cinter::safe_string s = snap[snap.find(name).value()];
+*/
+
+namespace detail
+{
+
+struct snapshot_header
+{
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint32_t byte_order;
+    std::uint32_t hash_function;
+    std::uint64_t file_size;
+    std::uint64_t checksum;
+    std::uint64_t string_count;
+    std::uint64_t slot_count;
+    std::uint64_t entries_offset;
+    std::uint64_t slots_offset;
+    std::uint64_t blob_offset;
+    std::uint64_t blob_size;
+};
+
+struct snapshot_entry
+{
+    std::uint64_t offset;
+    std::uint64_t length;
+    std::uint64_t hash;
+};
+
+struct snapshot_slot
+{
+    std::uint32_t id;
+    std::uint32_t tag;
+};
+
+inline constexpr char          snapshot_magic[8] = {'C', 'I', 'N', 'S', 'T', 'R', 'T', 'B'};
+inline constexpr std::uint32_t snapshot_version  = 2;
+inline constexpr std::uint32_t snapshot_empty    = static_cast<std::uint32_t>(-1);
+// Reads back as 0x04030201 on a machine of the other byte order.
+inline constexpr std::uint32_t snapshot_byte_order = 0x01020304;
+// The hashes are those of hash_with_length(), FNV-1a over the characters as
+// unsigned bytes with a MurmurHash3 finalizer.  Ids 1 and 2 were the same
+// hash over sign-extended and zero-extended char, which disagree on bytes
+// from 0x80, and are rejected.
+inline constexpr std::uint32_t snapshot_hash_function = 3;
+
+// Sets out to a + b, or returns false if that overflows.
+[[nodiscard]] constexpr bool checked_add(std::uint64_t a, std::uint64_t b, std::uint64_t& out) noexcept
+{
+    if (a > UINT64_MAX - b)
+    {
+        return false;
+    }
+    out = a + b;
+    return true;
+}
+
+// Sets out to a * b, or returns false if that overflows.
+[[nodiscard]] constexpr bool checked_multiply(std::uint64_t a, std::uint64_t b, std::uint64_t& out) noexcept
+{
+    if (b != 0 && a > UINT64_MAX / b)
+    {
+        return false;
+    }
+    out = a * b;
+    return true;
+}
+
+[[nodiscard]] constexpr std::uint64_t align8(std::uint64_t n) noexcept
+{
+    return (n + 7) / 8 * 8;
+}
+
+// Word-at-a-time checksum; fast enough to verify gigabytes at startup.
+class snapshot_checksum
+{
+    std::uint64_t state_   = 0x9e3779b97f4a7c15ull;
+    std::uint64_t pending_ = 0;
+    unsigned      count_   = 0;
+
+    void word(std::uint64_t w) noexcept
+    {
+        state_ = (state_ ^ mix_hash(w)) * 0x100000001b3ull;
+        state_ = (state_ << 31) | (state_ >> 33);
+    }
+
+public:
+    void update(const void* data, std::size_t size) noexcept
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        while (size && count_)
+        {
+            pending_ |= std::uint64_t{*p++} << (8 * count_);
+            --size;
+            if (++count_ == 8)
+            {
+                word(pending_);
+                pending_ = 0;
+                count_   = 0;
+            }
+        }
+        for (; size >= 8; p += 8, size -= 8)
+        {
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            word(w);
+        }
+        for (; size; --size)
+        {
+            pending_ |= std::uint64_t{*p++} << (8 * count_++);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept
+    {
+        return mix_hash(state_ ^ pending_ ^ count_);
+    }
+};
+
+} // namespace detail
+
+using snapshot_result = sentinel_result<int>;
+
+// Writes table to path.  Returns 0 or an errno value.  The file is written in
+// place; write to a temporary name and rename(2) it to replace a snapshot
+// that other processes may be opening.
+[[nodiscard]] inline snapshot_result save_snapshot(const string_table& table, const char* path)
+{
+    using namespace detail;
+
+    const std::uint64_t count      = table.size();
+    std::uint64_t       slot_count = 16;
+    while (slot_count < count * 2)
+    {
+        slot_count *= 2;
+    }
+
+    std::vector<snapshot_entry> entries(static_cast<std::size_t>(count));
+    std::vector<snapshot_slot>  slots(static_cast<std::size_t>(slot_count), snapshot_slot{snapshot_empty, 0});
+    std::uint64_t               blob_size = 0;
+    for (std::uint32_t id = 0; id < count; ++id)
+    {
+        entries[id] = snapshot_entry{blob_size, table.length(id), table.hash(id)};
+        blob_size += table.length(id) + 1;
+        std::uint64_t i = table.hash(id) & (slot_count - 1);
+        while (slots[static_cast<std::size_t>(i)].id != snapshot_empty)
+        {
+            i = (i + 1) & (slot_count - 1);
+        }
+        slots[static_cast<std::size_t>(i)] = snapshot_slot{id, static_cast<std::uint32_t>(table.hash(id) >> 32)};
+    }
+
+    snapshot_header header{};
+    std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+    header.version        = snapshot_version;
+    header.header_size    = static_cast<std::uint32_t>(align8(sizeof(header)));
+    header.byte_order     = snapshot_byte_order;
+    header.hash_function  = snapshot_hash_function;
+    header.string_count   = count;
+    header.slot_count     = slot_count;
+    header.entries_offset = header.header_size;
+    header.slots_offset   = align8(header.entries_offset + count * sizeof(snapshot_entry));
+    header.blob_offset    = align8(header.slots_offset + slot_count * sizeof(snapshot_slot));
+    header.blob_size      = blob_size;
+    header.file_size      = header.blob_offset + blob_size;
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (!file)
+    {
+        return errno;
+    }
+    static constexpr unsigned char zeros[8] = {};
+    snapshot_checksum              checksum;
+    std::uint64_t                  written = 0;
+    bool                           ok      = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    written += sizeof(header);
+    const auto write = [&](const void* data, std::size_t size) {
+        if (ok && size)
+        {
+            ok = std::fwrite(data, 1, size, file) == size;
+            checksum.update(data, size);
+            written += size;
+        }
+    };
+    const auto pad_to = [&](std::uint64_t offset) { write(zeros, static_cast<std::size_t>(offset - written)); };
+
+    pad_to(header.entries_offset);
+    write(entries.data(), entries.size() * sizeof(snapshot_entry));
+    pad_to(header.slots_offset);
+    write(slots.data(), slots.size() * sizeof(snapshot_slot));
+    pad_to(header.blob_offset);
+    for (std::uint32_t id = 0; id < count; ++id)
+    {
+        write(table[id].c_str(), table.length(id) + 1);
+    }
+
+    header.checksum = checksum.value();
+    ok              = ok && std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, file) == 1;
+    const int error = ok ? 0 : (errno ? errno : EIO);
+    if (std::fclose(file) != 0 && ok)
+    {
+        return errno ? errno : EIO;
+    }
+    return error;
+}
+
+// How much of a snapshot string_table_snapshot::open() checks.
+enum class snapshot_verify
+{
+    // Only the header; the default.  Lookups trust the entries and slots,
+    // so use this only for files this process or a trusted one wrote.
+    header,
+    // The header, and that every slot names a valid entry and every entry
+    // a terminated string inside the blob.  Reads the entries and slots and
+    // one byte of each string, so it touches every page of the file.
+    contents,
+    // contents, and the checksum of the whole file.
+    checksum
+};
+
+// A read-only string table mapped from a snapshot file.
+class string_table_snapshot
+{
+public:
+    using id_type     = std::uint32_t;
+    static constexpr id_type npos = detail::snapshot_empty;
+    using find_result = sentinel_result<id_type, npos, not_equal_to<id_type>>;
+
+private:
+    const unsigned char*           base_    = nullptr;
+    std::size_t                    size_    = 0;
+    const detail::snapshot_header* header_  = nullptr;
+    const detail::snapshot_entry*  entries_ = nullptr;
+    const detail::snapshot_slot*   slots_   = nullptr;
+    const char*                    blob_    = nullptr;
+
+    // Checks that the sections lie inside the file, in order and aligned,
+    // and that the index has room for at least one empty slot.
+    [[nodiscard]] static bool valid(const detail::snapshot_header& h, std::size_t size) noexcept
+    {
+        using namespace detail;
+        if (std::memcmp(h.magic, snapshot_magic, sizeof(h.magic)) != 0 || h.version != snapshot_version
+            || h.byte_order != snapshot_byte_order || h.hash_function != snapshot_hash_function
+            || h.header_size < sizeof(snapshot_header) || h.file_size != size || h.string_count >= npos
+            || h.slot_count == 0 || (h.slot_count & (h.slot_count - 1)) != 0 || h.slot_count <= h.string_count
+            || h.entries_offset < h.header_size || h.entries_offset % 8 != 0 || h.slots_offset % 8 != 0)
+        {
+            return false;
+        }
+        std::uint64_t entries_size;
+        std::uint64_t entries_end;
+        std::uint64_t slots_size;
+        std::uint64_t slots_end;
+        std::uint64_t blob_end;
+        return checked_multiply(h.string_count, sizeof(snapshot_entry), entries_size)
+               && checked_add(h.entries_offset, entries_size, entries_end) && entries_end <= h.slots_offset
+               && checked_multiply(h.slot_count, sizeof(snapshot_slot), slots_size)
+               && checked_add(h.slots_offset, slots_size, slots_end) && slots_end <= h.blob_offset
+               && checked_add(h.blob_offset, h.blob_size, blob_end) && blob_end == h.file_size;
+    }
+
+    // Checks every entry and slot against the header, which valid() accepted.
+    [[nodiscard]] bool valid_contents() const noexcept
+    {
+        const std::uint64_t blob_size = header_->blob_size;
+        for (std::uint64_t id = 0; id < header_->string_count; ++id)
+        {
+            const detail::snapshot_entry& e = entries_[id];
+            if (e.offset >= blob_size || e.length >= blob_size - e.offset || blob_[e.offset + e.length] != '\0')
+            {
+                return false;
+            }
+        }
+        bool has_empty_slot = false;
+        for (std::uint64_t i = 0; i < header_->slot_count; ++i)
+        {
+            const std::uint32_t id = slots_[i].id;
+            if (id == npos)
+            {
+                has_empty_slot = true;
+            }
+            else if (id >= header_->string_count)
+            {
+                return false;
+            }
+        }
+        return has_empty_slot;
+    }
+
+public:
+    string_table_snapshot() noexcept = default;
+
+    string_table_snapshot(string_table_snapshot&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    string_table_snapshot& operator=(string_table_snapshot&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            base_    = other.base_;
+            size_    = other.size_;
+            header_  = other.header_;
+            entries_ = other.entries_;
+            slots_   = other.slots_;
+            blob_    = other.blob_;
+            other.base_ = nullptr;
+            other.close();
+        }
+        return *this;
+    }
+
+    string_table_snapshot(const string_table_snapshot& other) = delete;
+    string_table_snapshot& operator=(const string_table_snapshot& other) = delete;
+
+    ~string_table_snapshot() noexcept
+    {
+        close();
+    }
+
+    // Maps a snapshot.  Returns 0, an errno value, or EINVAL if the file is
+    // not a valid snapshot of this version, byte order and hash function, or
+    // fails the checks selected by verify.
+    [[nodiscard]] snapshot_result open(const char* path, snapshot_verify verify = snapshot_verify::header) noexcept
+    {
+        close();
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return errno;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            return error;
+        }
+        const std::size_t size = static_cast<std::size_t>(st.st_size);
+        if (size < sizeof(detail::snapshot_header))
+        {
+            ::close(fd);
+            return EINVAL;
+        }
+        void* p = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (p == MAP_FAILED)
+        {
+            return error;
+        }
+        base_   = static_cast<const unsigned char*>(p);
+        size_   = size;
+        header_ = reinterpret_cast<const detail::snapshot_header*>(base_);
+        if (!valid(*header_, size_))
+        {
+            close();
+            return EINVAL;
+        }
+        if (verify == snapshot_verify::checksum)
+        {
+            detail::snapshot_checksum checksum;
+            checksum.update(base_ + sizeof(detail::snapshot_header), size_ - sizeof(detail::snapshot_header));
+            if (checksum.value() != header_->checksum)
+            {
+                close();
+                return EINVAL;
+            }
+        }
+        entries_ = reinterpret_cast<const detail::snapshot_entry*>(base_ + header_->entries_offset);
+        slots_   = reinterpret_cast<const detail::snapshot_slot*>(base_ + header_->slots_offset);
+        blob_    = reinterpret_cast<const char*>(base_ + header_->blob_offset);
+        if (verify != snapshot_verify::header && !valid_contents())
+        {
+            close();
+            return EINVAL;
+        }
+        return 0;
+    }
+
+    void close() noexcept
+    {
+        if (base_)
+        {
+            ::munmap(const_cast<unsigned char*>(base_), size_);
+        }
+        base_    = nullptr;
+        size_    = 0;
+        header_  = nullptr;
+        entries_ = nullptr;
+        slots_   = nullptr;
+        blob_    = nullptr;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return base_ != nullptr; }
+    [[nodiscard]] std::size_t size() const noexcept { return header_ ? header_->string_count : 0; }
+
+    [[nodiscard]] find_result find(safe_string key) const noexcept
+    {
+        if (!header_)
+        {
+            return npos;
+        }
+        const char*          str  = key.c_str();
+        const hashed_length  hl   = hash_with_length(key);
+        const std::uint64_t  mask = header_->slot_count - 1;
+        const std::uint32_t  tag  = static_cast<std::uint32_t>(hl.hash >> 32);
+        // Bounded by slot_count so that even an unchecked file without an
+        // empty slot cannot make a miss loop forever.
+        std::uint64_t i = hl.hash & mask;
+        for (std::uint64_t probes = 0; probes <= mask; ++probes, i = (i + 1) & mask)
+        {
+            const detail::snapshot_slot& s = slots_[i];
+            if (s.id == npos)
+            {
+                return npos;
+            }
+            if (s.tag == tag)
+            {
+                const detail::snapshot_entry& e = entries_[s.id];
+                if (e.length == hl.length && std::memcmp(blob_ + e.offset, str, hl.length) == 0)
+                {
+                    return s.id;
+                }
+            }
+        }
+        return npos;
+    }
+
+    // The string points into the mapping and is valid until close().
+    [[nodiscard]] safe_string operator[](id_type id) const noexcept { return blob_ + entries_[id].offset; }
+    [[nodiscard]] std::size_t length(id_type id) const noexcept { return static_cast<std::size_t>(entries_[id].length); }
+    [[nodiscard]] std::uint64_t hash(id_type id) const noexcept { return entries_[id].hash; }
+};
+
+} // namespace cinter
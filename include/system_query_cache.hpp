@@ -0,0 +1,305 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#pragma once
+#include "safe_string.hpp"
+#include "sentinel_result.hpp"
+#include "string_table.hpp"
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <pthread.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace cinter
+{
+
+using sysconf_result = sentinel_result<long, -1, not_equal_to<long>>;
+
+// Fields of uname(2).  The strings point into the cache and remain valid for
+// the lifetime of the cache, even after a refresh.
+struct uname_info
+{
+    safe_string sysname;
+    safe_string nodename;
+    safe_string release;
+    safe_string version;
+    safe_string machine;
+};
+
+using uname_result = sentinel_result<const uname_info*, nullptr, not_equal_to<const uname_info*>>;
+
+/*
+system_query_cache memoizes the results of idempotent C queries that hot
+code paths tend to repeat.
+
+Process constants (the page size and clock tick rate) are computed once.
+Values that can change at run time (the number of online processors, the
+host name and uname fields) are refreshed when they are older than ttl().
+Cached reads are lock free: an atomic load and, for refreshable values, a
+steady_clock read.  Only a refresh takes a lock.
+
+Strings are interned, so a safe_string returned by hostname() stays valid
+for the lifetime of the cache even after the host name changes.
+
+Call invalidate() after a known change (sethostname, CPU hotplug) or use
+install_fork_handler() to invalidate the process-wide instance in a child
+after fork().
+
+    long page = cinter::system_query_cache::instance().page_size().value();
+*/
+class system_query_cache
+{
+    static constexpr long not_cached = LONG_MIN;
+
+    struct timed_long
+    {
+        std::atomic<long>         value{0};
+        std::atomic<std::int64_t> expires{0};
+    };
+
+    struct timed_pointer
+    {
+        std::atomic<const void*>  value{nullptr};
+        std::atomic<std::int64_t> expires{0};
+    };
+
+    std::atomic<long>                        page_size_{not_cached};
+    std::atomic<long>                        clock_ticks_{not_cached};
+    timed_long                               online_processors_;
+    timed_pointer                            hostname_;
+    timed_pointer                            uname_;
+    std::atomic<std::int64_t>                ttl_;
+    std::mutex                               refresh_mutex_;
+    string_table                             strings_;
+    std::vector<std::unique_ptr<uname_info>> unames_;
+
+    [[nodiscard]] static std::int64_t now() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    [[nodiscard]] std::int64_t expiry() const noexcept
+    {
+        const std::int64_t ttl = ttl_.load(std::memory_order_relaxed);
+        const std::int64_t t   = now();
+        return ttl > INT64_MAX - t ? INT64_MAX : t + ttl;
+    }
+
+    [[nodiscard]] static long constant(std::atomic<long>& cell, int name) noexcept
+    {
+        long value = cell.load(std::memory_order_relaxed);
+        if (value == not_cached)
+        {
+            // Racing threads compute the same value, so a plain store is
+            // enough.  Failures are not cached so the next call retries.
+            value = ::sysconf(name);
+            if (value != -1)
+            {
+                cell.store(value, std::memory_order_relaxed);
+            }
+        }
+        return value;
+    }
+
+    [[nodiscard]] const char* intern_locked(safe_string s)
+    {
+        return strings_[strings_.intern(s)].c_str();
+    }
+
+    [[nodiscard]] const void* refresh_hostname()
+    {
+        // HOST_NAME_MAX is 64 on Linux; POSIX allows up to 255.
+        char name[256];
+        if (::gethostname(name, sizeof(name)) != 0)
+        {
+            return nullptr;
+        }
+        name[sizeof(name) - 1] = '\0';
+        std::lock_guard<std::mutex> lock(refresh_mutex_);
+        return intern_locked(name);
+    }
+
+    [[nodiscard]] const void* refresh_uname()
+    {
+        struct utsname u;
+        if (::uname(&u) != 0)
+        {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(refresh_mutex_);
+        uname_info info{intern_locked(u.sysname),
+                        intern_locked(u.nodename),
+                        intern_locked(u.release),
+                        intern_locked(u.version),
+                        intern_locked(u.machine)};
+        // Interned strings compare equal by pointer, so an unchanged uname
+        // reuses the previous snapshot instead of adding a new one.
+        if (!unames_.empty())
+        {
+            const uname_info& last = *unames_.back();
+            if (last.sysname.c_str() == info.sysname.c_str() && last.nodename.c_str() == info.nodename.c_str()
+                && last.release.c_str() == info.release.c_str() && last.version.c_str() == info.version.c_str()
+                && last.machine.c_str() == info.machine.c_str())
+            {
+                return unames_.back().get();
+            }
+        }
+        unames_.push_back(std::make_unique<uname_info>(info));
+        return unames_.back().get();
+    }
+
+    template <typename Refresh>
+    [[nodiscard]] const void* timed(timed_pointer& cell, Refresh refresh)
+    {
+        if (now() < cell.expires.load(std::memory_order_acquire))
+        {
+            return cell.value.load(std::memory_order_relaxed);
+        }
+        const void* value = refresh();
+        cell.value.store(value, std::memory_order_relaxed);
+        // Failures are not cached so the next call retries.
+        cell.expires.store(value ? expiry() : 0, std::memory_order_release);
+        return value;
+    }
+
+    // fork() handlers for instance().  A thread holding refresh_mutex_ at
+    // the fork would not exist in the child, so the mutex is held across
+    // the fork and released on both sides.
+    static void lock_instance() noexcept
+    {
+        instance().refresh_mutex_.lock();
+    }
+
+    static void unlock_instance() noexcept
+    {
+        instance().refresh_mutex_.unlock();
+    }
+
+    static void reset_instance_in_child() noexcept
+    {
+        system_query_cache& cache = instance();
+        cache.refresh_mutex_.unlock();
+        cache.invalidate();
+    }
+
+public:
+    static constexpr std::chrono::nanoseconds default_ttl = std::chrono::seconds(1);
+
+    system_query_cache() : ttl_(default_ttl.count()) {}
+
+    system_query_cache(const system_query_cache& other) = delete;
+    system_query_cache& operator=(const system_query_cache& other) = delete;
+
+    // The process-wide cache.
+    [[nodiscard]] static system_query_cache& instance()
+    {
+        static system_query_cache cache;
+        return cache;
+    }
+
+    // Invalidates instance() in the child after fork(), and keeps a refresh
+    // in another thread from leaving its lock held in the child.  Safe to
+    // call more than once; the handlers are registered only the first time.
+    static void install_fork_handler() noexcept
+    {
+        static const int registered = (static_cast<void>(instance()),
+                                       ::pthread_atfork(&lock_instance, &unlock_instance, &reset_instance_in_child));
+        (void)registered;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds ttl() const noexcept
+    {
+        return std::chrono::nanoseconds(ttl_.load(std::memory_order_relaxed));
+    }
+
+    // How long refreshable values are served from the cache.  Does not affect
+    // values that are already cached until they expire or are invalidated.
+    void set_ttl(std::chrono::nanoseconds ttl) noexcept
+    {
+        ttl_.store(ttl.count(), std::memory_order_relaxed);
+    }
+
+    // Forces every value to be queried again on its next use.
+    void invalidate() noexcept
+    {
+        page_size_.store(not_cached, std::memory_order_relaxed);
+        clock_ticks_.store(not_cached, std::memory_order_relaxed);
+        online_processors_.expires.store(0, std::memory_order_release);
+        hostname_.expires.store(0, std::memory_order_release);
+        uname_.expires.store(0, std::memory_order_release);
+    }
+
+    // sysconf(_SC_PAGESIZE), computed once.
+    [[nodiscard]] sysconf_result page_size() noexcept
+    {
+        return constant(page_size_, _SC_PAGESIZE);
+    }
+
+    // sysconf(_SC_CLK_TCK), computed once.
+    [[nodiscard]] sysconf_result clock_ticks() noexcept
+    {
+        return constant(clock_ticks_, _SC_CLK_TCK);
+    }
+
+    // sysconf(_SC_NPROCESSORS_ONLN), refreshed after ttl().
+    [[nodiscard]] sysconf_result online_processors() noexcept
+    {
+        if (now() < online_processors_.expires.load(std::memory_order_acquire))
+        {
+            return online_processors_.value.load(std::memory_order_relaxed);
+        }
+        const long value = ::sysconf(_SC_NPROCESSORS_ONLN);
+        online_processors_.value.store(value, std::memory_order_relaxed);
+        online_processors_.expires.store(value != -1 ? expiry() : 0, std::memory_order_release);
+        return value;
+    }
+
+    // gethostname(), refreshed after ttl().  Null if the call failed.
+    [[nodiscard]] safe_string hostname()
+    {
+        return static_cast<const char*>(timed(hostname_, [this] { return refresh_hostname(); }));
+    }
+
+    // uname(), refreshed after ttl().
+    [[nodiscard]] uname_result uname()
+    {
+        return static_cast<const uname_info*>(timed(uname_, [this] { return refresh_uname(); }));
+    }
+};
+
+} // namespace cinter
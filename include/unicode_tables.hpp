@@ -0,0 +1,2068 @@
+// Generated by tools/gen_unicode_tables.py from Unicode 14.0.0.  Do not edit.
+#pragma once
+#include <cstdint>
+
+namespace cinter
+{
+namespace detail
+{
+namespace unicode
+{
+
+inline constexpr char version[] = "14.0.0";
+
+inline constexpr unsigned block_bits = 7;
+
+// Property bits: canonical combining class in bits 0-7.
+inline constexpr std::uint16_t nfc_no    = 0x100;
+inline constexpr std::uint16_t nfc_maybe = 0x200;
+inline constexpr std::uint16_t nfd_no    = 0x400;
+
+inline constexpr std::uint16_t property_values[67] = {
+    0x0, 0x1, 0x6, 0x7, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c,
+    0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x54, 0x67, 0x6b, 0x76,
+    0x7a, 0x81, 0x82, 0x84, 0xca, 0xd6, 0xd8, 0xda, 0xdc, 0xde, 0xe0, 0xe2,
+    0xe4, 0xe6, 0xe8, 0xe9, 0xea, 0x200, 0x201, 0x207, 0x208, 0x209, 0x25b, 0x2ca,
+    0x2d8, 0x2dc, 0x2e6, 0x2f0, 0x400, 0x500, 0x5e6,
+};
+
+inline constexpr std::uint8_t property_stage1[8704] = {
+    0, 1, 2, 3, 4, 0, 5, 6, 7, 8, 0, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 35, 36,
+    0, 37, 38, 0, 39, 40, 41, 42, 43, 44, 0, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 58, 59, 60, 0, 0, 0, 0,
+    61, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 64, 0, 0,
+    65, 66, 67, 68, 0, 69, 0, 70, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 71,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 72, 73, 74, 75, 0,
+    0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 77, 0, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 80, 81, 0, 0, 0, 0, 82, 0, 0, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 0,
+    93, 94, 0, 95, 96, 97, 98, 0, 99, 0, 100, 101, 102, 103, 0, 0, 96, 0, 104, 105, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    113, 0, 107, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 116, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 72, 72, 72, 72, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint8_t property_stage2[15104] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 64, 64, 64, 64, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 0, 0,
+    64, 64, 64, 64, 64, 64, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 0, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 0, 64, 64, 64, 64, 0, 64, 64, 64, 64, 64, 64, 0,
+    0, 0, 0, 64, 64, 64, 64, 64, 64, 0, 0, 0, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 64, 64,
+    64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 0, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64,
+    0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    62, 62, 62, 62, 62, 49, 62, 62, 62, 62, 62, 62, 62, 49, 49, 62, 49, 62, 49, 62, 62, 50, 44, 44, 44, 44, 50, 60, 44, 44, 44, 44,
+    44, 40, 40, 61, 61, 61, 61, 59, 59, 44, 44, 44, 44, 61, 61, 44, 61, 61, 44, 44, 1, 1, 1, 1, 54, 44, 44, 44, 44, 49, 49, 49,
+    66, 66, 62, 66, 66, 63, 49, 44, 44, 44, 49, 49, 49, 44, 44, 0, 49, 49, 49, 44, 44, 44, 44, 49, 50, 44, 44, 49, 51, 52, 52, 51,
+    52, 52, 51, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0,
+    0, 0, 0, 0, 0, 64, 64, 65, 64, 64, 64, 0, 64, 0, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 0, 0, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 0, 64, 0, 0, 0, 64, 0, 0, 0, 0, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 0, 64, 0, 0, 0, 64, 0, 0, 0, 0, 64, 64, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 0, 0, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64,
+    0, 0, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 49, 49, 49, 49, 44, 49, 49, 49, 45, 44, 49, 49, 49, 49,
+    49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 49, 49, 45, 48, 49, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 0, 18,
+    0, 19, 20, 0, 49, 44, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 25, 26, 27, 0, 0, 0, 0, 0,
+    0, 0, 64, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25, 26, 27, 28, 29, 62, 62, 61, 44, 49, 49, 49, 49, 49, 44, 49, 49, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 49,
+    49, 49, 49, 44, 49, 0, 0, 49, 49, 0, 44, 49, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 49, 49, 44, 49, 49, 44, 44, 44, 49, 44, 44, 49, 44, 49,
+    49, 49, 44, 49, 44, 49, 44, 49, 44, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 44, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 0, 49, 49, 49, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 44, 44, 49, 49, 49, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 0, 44, 49, 49, 44, 49, 49, 44, 49, 49, 49, 44, 44, 44, 22, 23, 24, 49, 49, 49, 44, 49, 49, 44, 44, 49, 49, 49, 49, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 49, 44, 49, 49, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 65, 65, 0, 65,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 65, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 0, 0, 65, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 64, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 65, 65, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 32, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    64, 0, 53, 0, 0, 0, 0, 64, 64, 0, 64, 64, 0, 4, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 64, 64, 64, 53,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 35, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 44, 0, 42, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 65, 0, 0, 0, 0, 65, 0, 0, 0, 0, 65, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 37, 38, 65, 39, 65, 65, 0, 65, 0, 38, 38, 38, 38, 0, 0,
+    38, 65, 49, 49, 4, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0,
+    0, 0, 65, 0, 0, 0, 0, 65, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 49, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 0, 44,
+    44, 49, 49, 44, 44, 49, 49, 49, 49, 49, 44, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 53, 0, 0, 0, 0, 0, 64, 0, 64, 0, 0,
+    64, 64, 0, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 1, 44, 44, 44, 44, 44, 49, 49, 44, 44, 44, 44,
+    49, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 44, 49, 49, 49, 49, 49, 49, 49, 44, 49, 49, 52, 41, 44, 40, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 48, 48, 44, 43, 49, 51, 44, 49, 44,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 64, 0, 0, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 0, 64, 0, 64, 0, 64, 0, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 0, 64, 64, 64, 64, 64, 65, 64, 0, 65, 0,
+    0, 64, 64, 64, 64, 0, 64, 64, 64, 65, 64, 65, 64, 64, 64, 64, 64, 64, 64, 65, 0, 0, 64, 64, 64, 64, 64, 65, 0, 64, 64, 64,
+    64, 64, 64, 65, 64, 64, 64, 64, 64, 64, 64, 65, 64, 64, 65, 65, 0, 0, 64, 64, 64, 0, 64, 64, 64, 65, 64, 65, 64, 65, 0, 0,
+    65, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 1, 1, 49, 49, 49, 49, 1, 1, 1, 49, 49, 0, 0, 0,
+    0, 49, 0, 0, 0, 1, 1, 49, 44, 49, 1, 1, 44, 44, 44, 44, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 65, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 64, 0, 0, 0, 0, 64, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 64, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 64, 0, 0, 64, 0, 0, 64, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 0, 0, 64, 64, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0,
+    64, 64, 0, 0, 64, 64, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 48, 50, 45, 46, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0,
+    64, 0, 64, 0, 0, 64, 0, 64, 0, 64, 0, 0, 0, 0, 0, 0, 64, 64, 0, 64, 64, 0, 64, 64, 0, 64, 64, 0, 64, 64, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 56, 56, 0, 0, 0, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0,
+    64, 0, 64, 0, 0, 64, 0, 64, 0, 64, 0, 0, 0, 0, 0, 0, 64, 64, 0, 64, 64, 0, 64, 64, 0, 64, 64, 0, 64, 64, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 64, 64, 64, 64, 0, 0, 0, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 49, 49, 44, 0, 0, 49, 49, 0, 0, 0, 0, 0, 49, 49,
+    0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 65, 0, 65, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0,
+    65, 0, 65, 0, 0, 65, 65, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 21, 65,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 65, 65, 65, 65, 65, 0, 65, 0,
+    65, 65, 0, 65, 65, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 44, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 1, 44, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 44, 44, 49, 49, 49, 44, 49, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 49, 44, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 64, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 55, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 64, 64, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 64, 64, 53, 64, 0,
+    0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 0, 0, 0, 4,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 4, 4, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65,
+    65, 65, 65, 65, 65, 42, 42, 1, 1, 1, 0, 0, 0, 47, 42, 42, 42, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44,
+    44, 44, 44, 0, 0, 49, 49, 49, 49, 49, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65,
+    65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 49, 49, 49, 49, 49,
+    49, 49, 0, 49, 49, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+struct decomposition_entry
+{
+    std::uint32_t code_point;
+    std::uint16_t offset;
+    std::uint16_t length;
+};
+
+// Full canonical decompositions, sorted by code point (Hangul excluded).
+inline constexpr decomposition_entry decompositions[2061] = {
+    {0xc0, 0, 2}, {0xc1, 2, 2}, {0xc2, 4, 2}, {0xc3, 6, 2},
+    {0xc4, 8, 2}, {0xc5, 10, 2}, {0xc7, 12, 2}, {0xc8, 14, 2},
+    {0xc9, 16, 2}, {0xca, 18, 2}, {0xcb, 20, 2}, {0xcc, 22, 2},
+    {0xcd, 24, 2}, {0xce, 26, 2}, {0xcf, 28, 2}, {0xd1, 30, 2},
+    {0xd2, 32, 2}, {0xd3, 34, 2}, {0xd4, 36, 2}, {0xd5, 38, 2},
+    {0xd6, 40, 2}, {0xd9, 42, 2}, {0xda, 44, 2}, {0xdb, 46, 2},
+    {0xdc, 48, 2}, {0xdd, 50, 2}, {0xe0, 52, 2}, {0xe1, 54, 2},
+    {0xe2, 56, 2}, {0xe3, 58, 2}, {0xe4, 60, 2}, {0xe5, 62, 2},
+    {0xe7, 64, 2}, {0xe8, 66, 2}, {0xe9, 68, 2}, {0xea, 70, 2},
+    {0xeb, 72, 2}, {0xec, 74, 2}, {0xed, 76, 2}, {0xee, 78, 2},
+    {0xef, 80, 2}, {0xf1, 82, 2}, {0xf2, 84, 2}, {0xf3, 86, 2},
+    {0xf4, 88, 2}, {0xf5, 90, 2}, {0xf6, 92, 2}, {0xf9, 94, 2},
+    {0xfa, 96, 2}, {0xfb, 98, 2}, {0xfc, 100, 2}, {0xfd, 102, 2},
+    {0xff, 104, 2}, {0x100, 106, 2}, {0x101, 108, 2}, {0x102, 110, 2},
+    {0x103, 112, 2}, {0x104, 114, 2}, {0x105, 116, 2}, {0x106, 118, 2},
+    {0x107, 120, 2}, {0x108, 122, 2}, {0x109, 124, 2}, {0x10a, 126, 2},
+    {0x10b, 128, 2}, {0x10c, 130, 2}, {0x10d, 132, 2}, {0x10e, 134, 2},
+    {0x10f, 136, 2}, {0x112, 138, 2}, {0x113, 140, 2}, {0x114, 142, 2},
+    {0x115, 144, 2}, {0x116, 146, 2}, {0x117, 148, 2}, {0x118, 150, 2},
+    {0x119, 152, 2}, {0x11a, 154, 2}, {0x11b, 156, 2}, {0x11c, 158, 2},
+    {0x11d, 160, 2}, {0x11e, 162, 2}, {0x11f, 164, 2}, {0x120, 166, 2},
+    {0x121, 168, 2}, {0x122, 170, 2}, {0x123, 172, 2}, {0x124, 174, 2},
+    {0x125, 176, 2}, {0x128, 178, 2}, {0x129, 180, 2}, {0x12a, 182, 2},
+    {0x12b, 184, 2}, {0x12c, 186, 2}, {0x12d, 188, 2}, {0x12e, 190, 2},
+    {0x12f, 192, 2}, {0x130, 194, 2}, {0x134, 196, 2}, {0x135, 198, 2},
+    {0x136, 200, 2}, {0x137, 202, 2}, {0x139, 204, 2}, {0x13a, 206, 2},
+    {0x13b, 208, 2}, {0x13c, 210, 2}, {0x13d, 212, 2}, {0x13e, 214, 2},
+    {0x143, 216, 2}, {0x144, 218, 2}, {0x145, 220, 2}, {0x146, 222, 2},
+    {0x147, 224, 2}, {0x148, 226, 2}, {0x14c, 228, 2}, {0x14d, 230, 2},
+    {0x14e, 232, 2}, {0x14f, 234, 2}, {0x150, 236, 2}, {0x151, 238, 2},
+    {0x154, 240, 2}, {0x155, 242, 2}, {0x156, 244, 2}, {0x157, 246, 2},
+    {0x158, 248, 2}, {0x159, 250, 2}, {0x15a, 252, 2}, {0x15b, 254, 2},
+    {0x15c, 256, 2}, {0x15d, 258, 2}, {0x15e, 260, 2}, {0x15f, 262, 2},
+    {0x160, 264, 2}, {0x161, 266, 2}, {0x162, 268, 2}, {0x163, 270, 2},
+    {0x164, 272, 2}, {0x165, 274, 2}, {0x168, 276, 2}, {0x169, 278, 2},
+    {0x16a, 280, 2}, {0x16b, 282, 2}, {0x16c, 284, 2}, {0x16d, 286, 2},
+    {0x16e, 288, 2}, {0x16f, 290, 2}, {0x170, 292, 2}, {0x171, 294, 2},
+    {0x172, 296, 2}, {0x173, 298, 2}, {0x174, 300, 2}, {0x175, 302, 2},
+    {0x176, 304, 2}, {0x177, 306, 2}, {0x178, 308, 2}, {0x179, 310, 2},
+    {0x17a, 312, 2}, {0x17b, 314, 2}, {0x17c, 316, 2}, {0x17d, 318, 2},
+    {0x17e, 320, 2}, {0x1a0, 322, 2}, {0x1a1, 324, 2}, {0x1af, 326, 2},
+    {0x1b0, 328, 2}, {0x1cd, 330, 2}, {0x1ce, 332, 2}, {0x1cf, 334, 2},
+    {0x1d0, 336, 2}, {0x1d1, 338, 2}, {0x1d2, 340, 2}, {0x1d3, 342, 2},
+    {0x1d4, 344, 2}, {0x1d5, 346, 3}, {0x1d6, 349, 3}, {0x1d7, 352, 3},
+    {0x1d8, 355, 3}, {0x1d9, 358, 3}, {0x1da, 361, 3}, {0x1db, 364, 3},
+    {0x1dc, 367, 3}, {0x1de, 370, 3}, {0x1df, 373, 3}, {0x1e0, 376, 3},
+    {0x1e1, 379, 3}, {0x1e2, 382, 2}, {0x1e3, 384, 2}, {0x1e6, 386, 2},
+    {0x1e7, 388, 2}, {0x1e8, 390, 2}, {0x1e9, 392, 2}, {0x1ea, 394, 2},
+    {0x1eb, 396, 2}, {0x1ec, 398, 3}, {0x1ed, 401, 3}, {0x1ee, 404, 2},
+    {0x1ef, 406, 2}, {0x1f0, 408, 2}, {0x1f4, 410, 2}, {0x1f5, 412, 2},
+    {0x1f8, 414, 2}, {0x1f9, 416, 2}, {0x1fa, 418, 3}, {0x1fb, 421, 3},
+    {0x1fc, 424, 2}, {0x1fd, 426, 2}, {0x1fe, 428, 2}, {0x1ff, 430, 2},
+    {0x200, 432, 2}, {0x201, 434, 2}, {0x202, 436, 2}, {0x203, 438, 2},
+    {0x204, 440, 2}, {0x205, 442, 2}, {0x206, 444, 2}, {0x207, 446, 2},
+    {0x208, 448, 2}, {0x209, 450, 2}, {0x20a, 452, 2}, {0x20b, 454, 2},
+    {0x20c, 456, 2}, {0x20d, 458, 2}, {0x20e, 460, 2}, {0x20f, 462, 2},
+    {0x210, 464, 2}, {0x211, 466, 2}, {0x212, 468, 2}, {0x213, 470, 2},
+    {0x214, 472, 2}, {0x215, 474, 2}, {0x216, 476, 2}, {0x217, 478, 2},
+    {0x218, 480, 2}, {0x219, 482, 2}, {0x21a, 484, 2}, {0x21b, 486, 2},
+    {0x21e, 488, 2}, {0x21f, 490, 2}, {0x226, 492, 2}, {0x227, 494, 2},
+    {0x228, 496, 2}, {0x229, 498, 2}, {0x22a, 500, 3}, {0x22b, 503, 3},
+    {0x22c, 506, 3}, {0x22d, 509, 3}, {0x22e, 512, 2}, {0x22f, 514, 2},
+    {0x230, 516, 3}, {0x231, 519, 3}, {0x232, 522, 2}, {0x233, 524, 2},
+    {0x340, 526, 1}, {0x341, 527, 1}, {0x343, 528, 1}, {0x344, 529, 2},
+    {0x374, 531, 1}, {0x37e, 532, 1}, {0x385, 533, 2}, {0x386, 535, 2},
+    {0x387, 537, 1}, {0x388, 538, 2}, {0x389, 540, 2}, {0x38a, 542, 2},
+    {0x38c, 544, 2}, {0x38e, 546, 2}, {0x38f, 548, 2}, {0x390, 550, 3},
+    {0x3aa, 553, 2}, {0x3ab, 555, 2}, {0x3ac, 557, 2}, {0x3ad, 559, 2},
+    {0x3ae, 561, 2}, {0x3af, 563, 2}, {0x3b0, 565, 3}, {0x3ca, 568, 2},
+    {0x3cb, 570, 2}, {0x3cc, 572, 2}, {0x3cd, 574, 2}, {0x3ce, 576, 2},
+    {0x3d3, 578, 2}, {0x3d4, 580, 2}, {0x400, 582, 2}, {0x401, 584, 2},
+    {0x403, 586, 2}, {0x407, 588, 2}, {0x40c, 590, 2}, {0x40d, 592, 2},
+    {0x40e, 594, 2}, {0x419, 596, 2}, {0x439, 598, 2}, {0x450, 600, 2},
+    {0x451, 602, 2}, {0x453, 604, 2}, {0x457, 606, 2}, {0x45c, 608, 2},
+    {0x45d, 610, 2}, {0x45e, 612, 2}, {0x476, 614, 2}, {0x477, 616, 2},
+    {0x4c1, 618, 2}, {0x4c2, 620, 2}, {0x4d0, 622, 2}, {0x4d1, 624, 2},
+    {0x4d2, 626, 2}, {0x4d3, 628, 2}, {0x4d6, 630, 2}, {0x4d7, 632, 2},
+    {0x4da, 634, 2}, {0x4db, 636, 2}, {0x4dc, 638, 2}, {0x4dd, 640, 2},
+    {0x4de, 642, 2}, {0x4df, 644, 2}, {0x4e2, 646, 2}, {0x4e3, 648, 2},
+    {0x4e4, 650, 2}, {0x4e5, 652, 2}, {0x4e6, 654, 2}, {0x4e7, 656, 2},
+    {0x4ea, 658, 2}, {0x4eb, 660, 2}, {0x4ec, 662, 2}, {0x4ed, 664, 2},
+    {0x4ee, 666, 2}, {0x4ef, 668, 2}, {0x4f0, 670, 2}, {0x4f1, 672, 2},
+    {0x4f2, 674, 2}, {0x4f3, 676, 2}, {0x4f4, 678, 2}, {0x4f5, 680, 2},
+    {0x4f8, 682, 2}, {0x4f9, 684, 2}, {0x622, 686, 2}, {0x623, 688, 2},
+    {0x624, 690, 2}, {0x625, 692, 2}, {0x626, 694, 2}, {0x6c0, 696, 2},
+    {0x6c2, 698, 2}, {0x6d3, 700, 2}, {0x929, 702, 2}, {0x931, 704, 2},
+    {0x934, 706, 2}, {0x958, 708, 2}, {0x959, 710, 2}, {0x95a, 712, 2},
+    {0x95b, 714, 2}, {0x95c, 716, 2}, {0x95d, 718, 2}, {0x95e, 720, 2},
+    {0x95f, 722, 2}, {0x9cb, 724, 2}, {0x9cc, 726, 2}, {0x9dc, 728, 2},
+    {0x9dd, 730, 2}, {0x9df, 732, 2}, {0xa33, 734, 2}, {0xa36, 736, 2},
+    {0xa59, 738, 2}, {0xa5a, 740, 2}, {0xa5b, 742, 2}, {0xa5e, 744, 2},
+    {0xb48, 746, 2}, {0xb4b, 748, 2}, {0xb4c, 750, 2}, {0xb5c, 752, 2},
+    {0xb5d, 754, 2}, {0xb94, 756, 2}, {0xbca, 758, 2}, {0xbcb, 760, 2},
+    {0xbcc, 762, 2}, {0xc48, 764, 2}, {0xcc0, 766, 2}, {0xcc7, 768, 2},
+    {0xcc8, 770, 2}, {0xcca, 772, 2}, {0xccb, 774, 3}, {0xd4a, 777, 2},
+    {0xd4b, 779, 2}, {0xd4c, 781, 2}, {0xdda, 783, 2}, {0xddc, 785, 2},
+    {0xddd, 787, 3}, {0xdde, 790, 2}, {0xf43, 792, 2}, {0xf4d, 794, 2},
+    {0xf52, 796, 2}, {0xf57, 798, 2}, {0xf5c, 800, 2}, {0xf69, 802, 2},
+    {0xf73, 804, 2}, {0xf75, 806, 2}, {0xf76, 808, 2}, {0xf78, 810, 2},
+    {0xf81, 812, 2}, {0xf93, 814, 2}, {0xf9d, 816, 2}, {0xfa2, 818, 2},
+    {0xfa7, 820, 2}, {0xfac, 822, 2}, {0xfb9, 824, 2}, {0x1026, 826, 2},
+    {0x1b06, 828, 2}, {0x1b08, 830, 2}, {0x1b0a, 832, 2}, {0x1b0c, 834, 2},
+    {0x1b0e, 836, 2}, {0x1b12, 838, 2}, {0x1b3b, 840, 2}, {0x1b3d, 842, 2},
+    {0x1b40, 844, 2}, {0x1b41, 846, 2}, {0x1b43, 848, 2}, {0x1e00, 850, 2},
+    {0x1e01, 852, 2}, {0x1e02, 854, 2}, {0x1e03, 856, 2}, {0x1e04, 858, 2},
+    {0x1e05, 860, 2}, {0x1e06, 862, 2}, {0x1e07, 864, 2}, {0x1e08, 866, 3},
+    {0x1e09, 869, 3}, {0x1e0a, 872, 2}, {0x1e0b, 874, 2}, {0x1e0c, 876, 2},
+    {0x1e0d, 878, 2}, {0x1e0e, 880, 2}, {0x1e0f, 882, 2}, {0x1e10, 884, 2},
+    {0x1e11, 886, 2}, {0x1e12, 888, 2}, {0x1e13, 890, 2}, {0x1e14, 892, 3},
+    {0x1e15, 895, 3}, {0x1e16, 898, 3}, {0x1e17, 901, 3}, {0x1e18, 904, 2},
+    {0x1e19, 906, 2}, {0x1e1a, 908, 2}, {0x1e1b, 910, 2}, {0x1e1c, 912, 3},
+    {0x1e1d, 915, 3}, {0x1e1e, 918, 2}, {0x1e1f, 920, 2}, {0x1e20, 922, 2},
+    {0x1e21, 924, 2}, {0x1e22, 926, 2}, {0x1e23, 928, 2}, {0x1e24, 930, 2},
+    {0x1e25, 932, 2}, {0x1e26, 934, 2}, {0x1e27, 936, 2}, {0x1e28, 938, 2},
+    {0x1e29, 940, 2}, {0x1e2a, 942, 2}, {0x1e2b, 944, 2}, {0x1e2c, 946, 2},
+    {0x1e2d, 948, 2}, {0x1e2e, 950, 3}, {0x1e2f, 953, 3}, {0x1e30, 956, 2},
+    {0x1e31, 958, 2}, {0x1e32, 960, 2}, {0x1e33, 962, 2}, {0x1e34, 964, 2},
+    {0x1e35, 966, 2}, {0x1e36, 968, 2}, {0x1e37, 970, 2}, {0x1e38, 972, 3},
+    {0x1e39, 975, 3}, {0x1e3a, 978, 2}, {0x1e3b, 980, 2}, {0x1e3c, 982, 2},
+    {0x1e3d, 984, 2}, {0x1e3e, 986, 2}, {0x1e3f, 988, 2}, {0x1e40, 990, 2},
+    {0x1e41, 992, 2}, {0x1e42, 994, 2}, {0x1e43, 996, 2}, {0x1e44, 998, 2},
+    {0x1e45, 1000, 2}, {0x1e46, 1002, 2}, {0x1e47, 1004, 2}, {0x1e48, 1006, 2},
+    {0x1e49, 1008, 2}, {0x1e4a, 1010, 2}, {0x1e4b, 1012, 2}, {0x1e4c, 1014, 3},
+    {0x1e4d, 1017, 3}, {0x1e4e, 1020, 3}, {0x1e4f, 1023, 3}, {0x1e50, 1026, 3},
+    {0x1e51, 1029, 3}, {0x1e52, 1032, 3}, {0x1e53, 1035, 3}, {0x1e54, 1038, 2},
+    {0x1e55, 1040, 2}, {0x1e56, 1042, 2}, {0x1e57, 1044, 2}, {0x1e58, 1046, 2},
+    {0x1e59, 1048, 2}, {0x1e5a, 1050, 2}, {0x1e5b, 1052, 2}, {0x1e5c, 1054, 3},
+    {0x1e5d, 1057, 3}, {0x1e5e, 1060, 2}, {0x1e5f, 1062, 2}, {0x1e60, 1064, 2},
+    {0x1e61, 1066, 2}, {0x1e62, 1068, 2}, {0x1e63, 1070, 2}, {0x1e64, 1072, 3},
+    {0x1e65, 1075, 3}, {0x1e66, 1078, 3}, {0x1e67, 1081, 3}, {0x1e68, 1084, 3},
+    {0x1e69, 1087, 3}, {0x1e6a, 1090, 2}, {0x1e6b, 1092, 2}, {0x1e6c, 1094, 2},
+    {0x1e6d, 1096, 2}, {0x1e6e, 1098, 2}, {0x1e6f, 1100, 2}, {0x1e70, 1102, 2},
+    {0x1e71, 1104, 2}, {0x1e72, 1106, 2}, {0x1e73, 1108, 2}, {0x1e74, 1110, 2},
+    {0x1e75, 1112, 2}, {0x1e76, 1114, 2}, {0x1e77, 1116, 2}, {0x1e78, 1118, 3},
+    {0x1e79, 1121, 3}, {0x1e7a, 1124, 3}, {0x1e7b, 1127, 3}, {0x1e7c, 1130, 2},
+    {0x1e7d, 1132, 2}, {0x1e7e, 1134, 2}, {0x1e7f, 1136, 2}, {0x1e80, 1138, 2},
+    {0x1e81, 1140, 2}, {0x1e82, 1142, 2}, {0x1e83, 1144, 2}, {0x1e84, 1146, 2},
+    {0x1e85, 1148, 2}, {0x1e86, 1150, 2}, {0x1e87, 1152, 2}, {0x1e88, 1154, 2},
+    {0x1e89, 1156, 2}, {0x1e8a, 1158, 2}, {0x1e8b, 1160, 2}, {0x1e8c, 1162, 2},
+    {0x1e8d, 1164, 2}, {0x1e8e, 1166, 2}, {0x1e8f, 1168, 2}, {0x1e90, 1170, 2},
+    {0x1e91, 1172, 2}, {0x1e92, 1174, 2}, {0x1e93, 1176, 2}, {0x1e94, 1178, 2},
+    {0x1e95, 1180, 2}, {0x1e96, 1182, 2}, {0x1e97, 1184, 2}, {0x1e98, 1186, 2},
+    {0x1e99, 1188, 2}, {0x1e9b, 1190, 2}, {0x1ea0, 1192, 2}, {0x1ea1, 1194, 2},
+    {0x1ea2, 1196, 2}, {0x1ea3, 1198, 2}, {0x1ea4, 1200, 3}, {0x1ea5, 1203, 3},
+    {0x1ea6, 1206, 3}, {0x1ea7, 1209, 3}, {0x1ea8, 1212, 3}, {0x1ea9, 1215, 3},
+    {0x1eaa, 1218, 3}, {0x1eab, 1221, 3}, {0x1eac, 1224, 3}, {0x1ead, 1227, 3},
+    {0x1eae, 1230, 3}, {0x1eaf, 1233, 3}, {0x1eb0, 1236, 3}, {0x1eb1, 1239, 3},
+    {0x1eb2, 1242, 3}, {0x1eb3, 1245, 3}, {0x1eb4, 1248, 3}, {0x1eb5, 1251, 3},
+    {0x1eb6, 1254, 3}, {0x1eb7, 1257, 3}, {0x1eb8, 1260, 2}, {0x1eb9, 1262, 2},
+    {0x1eba, 1264, 2}, {0x1ebb, 1266, 2}, {0x1ebc, 1268, 2}, {0x1ebd, 1270, 2},
+    {0x1ebe, 1272, 3}, {0x1ebf, 1275, 3}, {0x1ec0, 1278, 3}, {0x1ec1, 1281, 3},
+    {0x1ec2, 1284, 3}, {0x1ec3, 1287, 3}, {0x1ec4, 1290, 3}, {0x1ec5, 1293, 3},
+    {0x1ec6, 1296, 3}, {0x1ec7, 1299, 3}, {0x1ec8, 1302, 2}, {0x1ec9, 1304, 2},
+    {0x1eca, 1306, 2}, {0x1ecb, 1308, 2}, {0x1ecc, 1310, 2}, {0x1ecd, 1312, 2},
+    {0x1ece, 1314, 2}, {0x1ecf, 1316, 2}, {0x1ed0, 1318, 3}, {0x1ed1, 1321, 3},
+    {0x1ed2, 1324, 3}, {0x1ed3, 1327, 3}, {0x1ed4, 1330, 3}, {0x1ed5, 1333, 3},
+    {0x1ed6, 1336, 3}, {0x1ed7, 1339, 3}, {0x1ed8, 1342, 3}, {0x1ed9, 1345, 3},
+    {0x1eda, 1348, 3}, {0x1edb, 1351, 3}, {0x1edc, 1354, 3}, {0x1edd, 1357, 3},
+    {0x1ede, 1360, 3}, {0x1edf, 1363, 3}, {0x1ee0, 1366, 3}, {0x1ee1, 1369, 3},
+    {0x1ee2, 1372, 3}, {0x1ee3, 1375, 3}, {0x1ee4, 1378, 2}, {0x1ee5, 1380, 2},
+    {0x1ee6, 1382, 2}, {0x1ee7, 1384, 2}, {0x1ee8, 1386, 3}, {0x1ee9, 1389, 3},
+    {0x1eea, 1392, 3}, {0x1eeb, 1395, 3}, {0x1eec, 1398, 3}, {0x1eed, 1401, 3},
+    {0x1eee, 1404, 3}, {0x1eef, 1407, 3}, {0x1ef0, 1410, 3}, {0x1ef1, 1413, 3},
+    {0x1ef2, 1416, 2}, {0x1ef3, 1418, 2}, {0x1ef4, 1420, 2}, {0x1ef5, 1422, 2},
+    {0x1ef6, 1424, 2}, {0x1ef7, 1426, 2}, {0x1ef8, 1428, 2}, {0x1ef9, 1430, 2},
+    {0x1f00, 1432, 2}, {0x1f01, 1434, 2}, {0x1f02, 1436, 3}, {0x1f03, 1439, 3},
+    {0x1f04, 1442, 3}, {0x1f05, 1445, 3}, {0x1f06, 1448, 3}, {0x1f07, 1451, 3},
+    {0x1f08, 1454, 2}, {0x1f09, 1456, 2}, {0x1f0a, 1458, 3}, {0x1f0b, 1461, 3},
+    {0x1f0c, 1464, 3}, {0x1f0d, 1467, 3}, {0x1f0e, 1470, 3}, {0x1f0f, 1473, 3},
+    {0x1f10, 1476, 2}, {0x1f11, 1478, 2}, {0x1f12, 1480, 3}, {0x1f13, 1483, 3},
+    {0x1f14, 1486, 3}, {0x1f15, 1489, 3}, {0x1f18, 1492, 2}, {0x1f19, 1494, 2},
+    {0x1f1a, 1496, 3}, {0x1f1b, 1499, 3}, {0x1f1c, 1502, 3}, {0x1f1d, 1505, 3},
+    {0x1f20, 1508, 2}, {0x1f21, 1510, 2}, {0x1f22, 1512, 3}, {0x1f23, 1515, 3},
+    {0x1f24, 1518, 3}, {0x1f25, 1521, 3}, {0x1f26, 1524, 3}, {0x1f27, 1527, 3},
+    {0x1f28, 1530, 2}, {0x1f29, 1532, 2}, {0x1f2a, 1534, 3}, {0x1f2b, 1537, 3},
+    {0x1f2c, 1540, 3}, {0x1f2d, 1543, 3}, {0x1f2e, 1546, 3}, {0x1f2f, 1549, 3},
+    {0x1f30, 1552, 2}, {0x1f31, 1554, 2}, {0x1f32, 1556, 3}, {0x1f33, 1559, 3},
+    {0x1f34, 1562, 3}, {0x1f35, 1565, 3}, {0x1f36, 1568, 3}, {0x1f37, 1571, 3},
+    {0x1f38, 1574, 2}, {0x1f39, 1576, 2}, {0x1f3a, 1578, 3}, {0x1f3b, 1581, 3},
+    {0x1f3c, 1584, 3}, {0x1f3d, 1587, 3}, {0x1f3e, 1590, 3}, {0x1f3f, 1593, 3},
+    {0x1f40, 1596, 2}, {0x1f41, 1598, 2}, {0x1f42, 1600, 3}, {0x1f43, 1603, 3},
+    {0x1f44, 1606, 3}, {0x1f45, 1609, 3}, {0x1f48, 1612, 2}, {0x1f49, 1614, 2},
+    {0x1f4a, 1616, 3}, {0x1f4b, 1619, 3}, {0x1f4c, 1622, 3}, {0x1f4d, 1625, 3},
+    {0x1f50, 1628, 2}, {0x1f51, 1630, 2}, {0x1f52, 1632, 3}, {0x1f53, 1635, 3},
+    {0x1f54, 1638, 3}, {0x1f55, 1641, 3}, {0x1f56, 1644, 3}, {0x1f57, 1647, 3},
+    {0x1f59, 1650, 2}, {0x1f5b, 1652, 3}, {0x1f5d, 1655, 3}, {0x1f5f, 1658, 3},
+    {0x1f60, 1661, 2}, {0x1f61, 1663, 2}, {0x1f62, 1665, 3}, {0x1f63, 1668, 3},
+    {0x1f64, 1671, 3}, {0x1f65, 1674, 3}, {0x1f66, 1677, 3}, {0x1f67, 1680, 3},
+    {0x1f68, 1683, 2}, {0x1f69, 1685, 2}, {0x1f6a, 1687, 3}, {0x1f6b, 1690, 3},
+    {0x1f6c, 1693, 3}, {0x1f6d, 1696, 3}, {0x1f6e, 1699, 3}, {0x1f6f, 1702, 3},
+    {0x1f70, 1705, 2}, {0x1f71, 1707, 2}, {0x1f72, 1709, 2}, {0x1f73, 1711, 2},
+    {0x1f74, 1713, 2}, {0x1f75, 1715, 2}, {0x1f76, 1717, 2}, {0x1f77, 1719, 2},
+    {0x1f78, 1721, 2}, {0x1f79, 1723, 2}, {0x1f7a, 1725, 2}, {0x1f7b, 1727, 2},
+    {0x1f7c, 1729, 2}, {0x1f7d, 1731, 2}, {0x1f80, 1733, 3}, {0x1f81, 1736, 3},
+    {0x1f82, 1739, 4}, {0x1f83, 1743, 4}, {0x1f84, 1747, 4}, {0x1f85, 1751, 4},
+    {0x1f86, 1755, 4}, {0x1f87, 1759, 4}, {0x1f88, 1763, 3}, {0x1f89, 1766, 3},
+    {0x1f8a, 1769, 4}, {0x1f8b, 1773, 4}, {0x1f8c, 1777, 4}, {0x1f8d, 1781, 4},
+    {0x1f8e, 1785, 4}, {0x1f8f, 1789, 4}, {0x1f90, 1793, 3}, {0x1f91, 1796, 3},
+    {0x1f92, 1799, 4}, {0x1f93, 1803, 4}, {0x1f94, 1807, 4}, {0x1f95, 1811, 4},
+    {0x1f96, 1815, 4}, {0x1f97, 1819, 4}, {0x1f98, 1823, 3}, {0x1f99, 1826, 3},
+    {0x1f9a, 1829, 4}, {0x1f9b, 1833, 4}, {0x1f9c, 1837, 4}, {0x1f9d, 1841, 4},
+    {0x1f9e, 1845, 4}, {0x1f9f, 1849, 4}, {0x1fa0, 1853, 3}, {0x1fa1, 1856, 3},
+    {0x1fa2, 1859, 4}, {0x1fa3, 1863, 4}, {0x1fa4, 1867, 4}, {0x1fa5, 1871, 4},
+    {0x1fa6, 1875, 4}, {0x1fa7, 1879, 4}, {0x1fa8, 1883, 3}, {0x1fa9, 1886, 3},
+    {0x1faa, 1889, 4}, {0x1fab, 1893, 4}, {0x1fac, 1897, 4}, {0x1fad, 1901, 4},
+    {0x1fae, 1905, 4}, {0x1faf, 1909, 4}, {0x1fb0, 1913, 2}, {0x1fb1, 1915, 2},
+    {0x1fb2, 1917, 3}, {0x1fb3, 1920, 2}, {0x1fb4, 1922, 3}, {0x1fb6, 1925, 2},
+    {0x1fb7, 1927, 3}, {0x1fb8, 1930, 2}, {0x1fb9, 1932, 2}, {0x1fba, 1934, 2},
+    {0x1fbb, 1936, 2}, {0x1fbc, 1938, 2}, {0x1fbe, 1940, 1}, {0x1fc1, 1941, 2},
+    {0x1fc2, 1943, 3}, {0x1fc3, 1946, 2}, {0x1fc4, 1948, 3}, {0x1fc6, 1951, 2},
+    {0x1fc7, 1953, 3}, {0x1fc8, 1956, 2}, {0x1fc9, 1958, 2}, {0x1fca, 1960, 2},
+    {0x1fcb, 1962, 2}, {0x1fcc, 1964, 2}, {0x1fcd, 1966, 2}, {0x1fce, 1968, 2},
+    {0x1fcf, 1970, 2}, {0x1fd0, 1972, 2}, {0x1fd1, 1974, 2}, {0x1fd2, 1976, 3},
+    {0x1fd3, 1979, 3}, {0x1fd6, 1982, 2}, {0x1fd7, 1984, 3}, {0x1fd8, 1987, 2},
+    {0x1fd9, 1989, 2}, {0x1fda, 1991, 2}, {0x1fdb, 1993, 2}, {0x1fdd, 1995, 2},
+    {0x1fde, 1997, 2}, {0x1fdf, 1999, 2}, {0x1fe0, 2001, 2}, {0x1fe1, 2003, 2},
+    {0x1fe2, 2005, 3}, {0x1fe3, 2008, 3}, {0x1fe4, 2011, 2}, {0x1fe5, 2013, 2},
+    {0x1fe6, 2015, 2}, {0x1fe7, 2017, 3}, {0x1fe8, 2020, 2}, {0x1fe9, 2022, 2},
+    {0x1fea, 2024, 2}, {0x1feb, 2026, 2}, {0x1fec, 2028, 2}, {0x1fed, 2030, 2},
+    {0x1fee, 2032, 2}, {0x1fef, 2034, 1}, {0x1ff2, 2035, 3}, {0x1ff3, 2038, 2},
+    {0x1ff4, 2040, 3}, {0x1ff6, 2043, 2}, {0x1ff7, 2045, 3}, {0x1ff8, 2048, 2},
+    {0x1ff9, 2050, 2}, {0x1ffa, 2052, 2}, {0x1ffb, 2054, 2}, {0x1ffc, 2056, 2},
+    {0x1ffd, 2058, 1}, {0x2000, 2059, 1}, {0x2001, 2060, 1}, {0x2126, 2061, 1},
+    {0x212a, 2062, 1}, {0x212b, 2063, 2}, {0x219a, 2065, 2}, {0x219b, 2067, 2},
+    {0x21ae, 2069, 2}, {0x21cd, 2071, 2}, {0x21ce, 2073, 2}, {0x21cf, 2075, 2},
+    {0x2204, 2077, 2}, {0x2209, 2079, 2}, {0x220c, 2081, 2}, {0x2224, 2083, 2},
+    {0x2226, 2085, 2}, {0x2241, 2087, 2}, {0x2244, 2089, 2}, {0x2247, 2091, 2},
+    {0x2249, 2093, 2}, {0x2260, 2095, 2}, {0x2262, 2097, 2}, {0x226d, 2099, 2},
+    {0x226e, 2101, 2}, {0x226f, 2103, 2}, {0x2270, 2105, 2}, {0x2271, 2107, 2},
+    {0x2274, 2109, 2}, {0x2275, 2111, 2}, {0x2278, 2113, 2}, {0x2279, 2115, 2},
+    {0x2280, 2117, 2}, {0x2281, 2119, 2}, {0x2284, 2121, 2}, {0x2285, 2123, 2},
+    {0x2288, 2125, 2}, {0x2289, 2127, 2}, {0x22ac, 2129, 2}, {0x22ad, 2131, 2},
+    {0x22ae, 2133, 2}, {0x22af, 2135, 2}, {0x22e0, 2137, 2}, {0x22e1, 2139, 2},
+    {0x22e2, 2141, 2}, {0x22e3, 2143, 2}, {0x22ea, 2145, 2}, {0x22eb, 2147, 2},
+    {0x22ec, 2149, 2}, {0x22ed, 2151, 2}, {0x2329, 2153, 1}, {0x232a, 2154, 1},
+    {0x2adc, 2155, 2}, {0x304c, 2157, 2}, {0x304e, 2159, 2}, {0x3050, 2161, 2},
+    {0x3052, 2163, 2}, {0x3054, 2165, 2}, {0x3056, 2167, 2}, {0x3058, 2169, 2},
+    {0x305a, 2171, 2}, {0x305c, 2173, 2}, {0x305e, 2175, 2}, {0x3060, 2177, 2},
+    {0x3062, 2179, 2}, {0x3065, 2181, 2}, {0x3067, 2183, 2}, {0x3069, 2185, 2},
+    {0x3070, 2187, 2}, {0x3071, 2189, 2}, {0x3073, 2191, 2}, {0x3074, 2193, 2},
+    {0x3076, 2195, 2}, {0x3077, 2197, 2}, {0x3079, 2199, 2}, {0x307a, 2201, 2},
+    {0x307c, 2203, 2}, {0x307d, 2205, 2}, {0x3094, 2207, 2}, {0x309e, 2209, 2},
+    {0x30ac, 2211, 2}, {0x30ae, 2213, 2}, {0x30b0, 2215, 2}, {0x30b2, 2217, 2},
+    {0x30b4, 2219, 2}, {0x30b6, 2221, 2}, {0x30b8, 2223, 2}, {0x30ba, 2225, 2},
+    {0x30bc, 2227, 2}, {0x30be, 2229, 2}, {0x30c0, 2231, 2}, {0x30c2, 2233, 2},
+    {0x30c5, 2235, 2}, {0x30c7, 2237, 2}, {0x30c9, 2239, 2}, {0x30d0, 2241, 2},
+    {0x30d1, 2243, 2}, {0x30d3, 2245, 2}, {0x30d4, 2247, 2}, {0x30d6, 2249, 2},
+    {0x30d7, 2251, 2}, {0x30d9, 2253, 2}, {0x30da, 2255, 2}, {0x30dc, 2257, 2},
+    {0x30dd, 2259, 2}, {0x30f4, 2261, 2}, {0x30f7, 2263, 2}, {0x30f8, 2265, 2},
+    {0x30f9, 2267, 2}, {0x30fa, 2269, 2}, {0x30fe, 2271, 2}, {0xf900, 2273, 1},
+    {0xf901, 2274, 1}, {0xf902, 2275, 1}, {0xf903, 2276, 1}, {0xf904, 2277, 1},
+    {0xf905, 2278, 1}, {0xf906, 2279, 1}, {0xf907, 2280, 1}, {0xf908, 2281, 1},
+    {0xf909, 2282, 1}, {0xf90a, 2283, 1}, {0xf90b, 2284, 1}, {0xf90c, 2285, 1},
+    {0xf90d, 2286, 1}, {0xf90e, 2287, 1}, {0xf90f, 2288, 1}, {0xf910, 2289, 1},
+    {0xf911, 2290, 1}, {0xf912, 2291, 1}, {0xf913, 2292, 1}, {0xf914, 2293, 1},
+    {0xf915, 2294, 1}, {0xf916, 2295, 1}, {0xf917, 2296, 1}, {0xf918, 2297, 1},
+    {0xf919, 2298, 1}, {0xf91a, 2299, 1}, {0xf91b, 2300, 1}, {0xf91c, 2301, 1},
+    {0xf91d, 2302, 1}, {0xf91e, 2303, 1}, {0xf91f, 2304, 1}, {0xf920, 2305, 1},
+    {0xf921, 2306, 1}, {0xf922, 2307, 1}, {0xf923, 2308, 1}, {0xf924, 2309, 1},
+    {0xf925, 2310, 1}, {0xf926, 2311, 1}, {0xf927, 2312, 1}, {0xf928, 2313, 1},
+    {0xf929, 2314, 1}, {0xf92a, 2315, 1}, {0xf92b, 2316, 1}, {0xf92c, 2317, 1},
+    {0xf92d, 2318, 1}, {0xf92e, 2319, 1}, {0xf92f, 2320, 1}, {0xf930, 2321, 1},
+    {0xf931, 2322, 1}, {0xf932, 2323, 1}, {0xf933, 2324, 1}, {0xf934, 2325, 1},
+    {0xf935, 2326, 1}, {0xf936, 2327, 1}, {0xf937, 2328, 1}, {0xf938, 2329, 1},
+    {0xf939, 2330, 1}, {0xf93a, 2331, 1}, {0xf93b, 2332, 1}, {0xf93c, 2333, 1},
+    {0xf93d, 2334, 1}, {0xf93e, 2335, 1}, {0xf93f, 2336, 1}, {0xf940, 2337, 1},
+    {0xf941, 2338, 1}, {0xf942, 2339, 1}, {0xf943, 2340, 1}, {0xf944, 2341, 1},
+    {0xf945, 2342, 1}, {0xf946, 2343, 1}, {0xf947, 2344, 1}, {0xf948, 2345, 1},
+    {0xf949, 2346, 1}, {0xf94a, 2347, 1}, {0xf94b, 2348, 1}, {0xf94c, 2349, 1},
+    {0xf94d, 2350, 1}, {0xf94e, 2351, 1}, {0xf94f, 2352, 1}, {0xf950, 2353, 1},
+    {0xf951, 2354, 1}, {0xf952, 2355, 1}, {0xf953, 2356, 1}, {0xf954, 2357, 1},
+    {0xf955, 2358, 1}, {0xf956, 2359, 1}, {0xf957, 2360, 1}, {0xf958, 2361, 1},
+    {0xf959, 2362, 1}, {0xf95a, 2363, 1}, {0xf95b, 2364, 1}, {0xf95c, 2365, 1},
+    {0xf95d, 2366, 1}, {0xf95e, 2367, 1}, {0xf95f, 2368, 1}, {0xf960, 2369, 1},
+    {0xf961, 2370, 1}, {0xf962, 2371, 1}, {0xf963, 2372, 1}, {0xf964, 2373, 1},
+    {0xf965, 2374, 1}, {0xf966, 2375, 1}, {0xf967, 2376, 1}, {0xf968, 2377, 1},
+    {0xf969, 2378, 1}, {0xf96a, 2379, 1}, {0xf96b, 2380, 1}, {0xf96c, 2381, 1},
+    {0xf96d, 2382, 1}, {0xf96e, 2383, 1}, {0xf96f, 2384, 1}, {0xf970, 2385, 1},
+    {0xf971, 2386, 1}, {0xf972, 2387, 1}, {0xf973, 2388, 1}, {0xf974, 2389, 1},
+    {0xf975, 2390, 1}, {0xf976, 2391, 1}, {0xf977, 2392, 1}, {0xf978, 2393, 1},
+    {0xf979, 2394, 1}, {0xf97a, 2395, 1}, {0xf97b, 2396, 1}, {0xf97c, 2397, 1},
+    {0xf97d, 2398, 1}, {0xf97e, 2399, 1}, {0xf97f, 2400, 1}, {0xf980, 2401, 1},
+    {0xf981, 2402, 1}, {0xf982, 2403, 1}, {0xf983, 2404, 1}, {0xf984, 2405, 1},
+    {0xf985, 2406, 1}, {0xf986, 2407, 1}, {0xf987, 2408, 1}, {0xf988, 2409, 1},
+    {0xf989, 2410, 1}, {0xf98a, 2411, 1}, {0xf98b, 2412, 1}, {0xf98c, 2413, 1},
+    {0xf98d, 2414, 1}, {0xf98e, 2415, 1}, {0xf98f, 2416, 1}, {0xf990, 2417, 1},
+    {0xf991, 2418, 1}, {0xf992, 2419, 1}, {0xf993, 2420, 1}, {0xf994, 2421, 1},
+    {0xf995, 2422, 1}, {0xf996, 2423, 1}, {0xf997, 2424, 1}, {0xf998, 2425, 1},
+    {0xf999, 2426, 1}, {0xf99a, 2427, 1}, {0xf99b, 2428, 1}, {0xf99c, 2429, 1},
+    {0xf99d, 2430, 1}, {0xf99e, 2431, 1}, {0xf99f, 2432, 1}, {0xf9a0, 2433, 1},
+    {0xf9a1, 2434, 1}, {0xf9a2, 2435, 1}, {0xf9a3, 2436, 1}, {0xf9a4, 2437, 1},
+    {0xf9a5, 2438, 1}, {0xf9a6, 2439, 1}, {0xf9a7, 2440, 1}, {0xf9a8, 2441, 1},
+    {0xf9a9, 2442, 1}, {0xf9aa, 2443, 1}, {0xf9ab, 2444, 1}, {0xf9ac, 2445, 1},
+    {0xf9ad, 2446, 1}, {0xf9ae, 2447, 1}, {0xf9af, 2448, 1}, {0xf9b0, 2449, 1},
+    {0xf9b1, 2450, 1}, {0xf9b2, 2451, 1}, {0xf9b3, 2452, 1}, {0xf9b4, 2453, 1},
+    {0xf9b5, 2454, 1}, {0xf9b6, 2455, 1}, {0xf9b7, 2456, 1}, {0xf9b8, 2457, 1},
+    {0xf9b9, 2458, 1}, {0xf9ba, 2459, 1}, {0xf9bb, 2460, 1}, {0xf9bc, 2461, 1},
+    {0xf9bd, 2462, 1}, {0xf9be, 2463, 1}, {0xf9bf, 2464, 1}, {0xf9c0, 2465, 1},
+    {0xf9c1, 2466, 1}, {0xf9c2, 2467, 1}, {0xf9c3, 2468, 1}, {0xf9c4, 2469, 1},
+    {0xf9c5, 2470, 1}, {0xf9c6, 2471, 1}, {0xf9c7, 2472, 1}, {0xf9c8, 2473, 1},
+    {0xf9c9, 2474, 1}, {0xf9ca, 2475, 1}, {0xf9cb, 2476, 1}, {0xf9cc, 2477, 1},
+    {0xf9cd, 2478, 1}, {0xf9ce, 2479, 1}, {0xf9cf, 2480, 1}, {0xf9d0, 2481, 1},
+    {0xf9d1, 2482, 1}, {0xf9d2, 2483, 1}, {0xf9d3, 2484, 1}, {0xf9d4, 2485, 1},
+    {0xf9d5, 2486, 1}, {0xf9d6, 2487, 1}, {0xf9d7, 2488, 1}, {0xf9d8, 2489, 1},
+    {0xf9d9, 2490, 1}, {0xf9da, 2491, 1}, {0xf9db, 2492, 1}, {0xf9dc, 2493, 1},
+    {0xf9dd, 2494, 1}, {0xf9de, 2495, 1}, {0xf9df, 2496, 1}, {0xf9e0, 2497, 1},
+    {0xf9e1, 2498, 1}, {0xf9e2, 2499, 1}, {0xf9e3, 2500, 1}, {0xf9e4, 2501, 1},
+    {0xf9e5, 2502, 1}, {0xf9e6, 2503, 1}, {0xf9e7, 2504, 1}, {0xf9e8, 2505, 1},
+    {0xf9e9, 2506, 1}, {0xf9ea, 2507, 1}, {0xf9eb, 2508, 1}, {0xf9ec, 2509, 1},
+    {0xf9ed, 2510, 1}, {0xf9ee, 2511, 1}, {0xf9ef, 2512, 1}, {0xf9f0, 2513, 1},
+    {0xf9f1, 2514, 1}, {0xf9f2, 2515, 1}, {0xf9f3, 2516, 1}, {0xf9f4, 2517, 1},
+    {0xf9f5, 2518, 1}, {0xf9f6, 2519, 1}, {0xf9f7, 2520, 1}, {0xf9f8, 2521, 1},
+    {0xf9f9, 2522, 1}, {0xf9fa, 2523, 1}, {0xf9fb, 2524, 1}, {0xf9fc, 2525, 1},
+    {0xf9fd, 2526, 1}, {0xf9fe, 2527, 1}, {0xf9ff, 2528, 1}, {0xfa00, 2529, 1},
+    {0xfa01, 2530, 1}, {0xfa02, 2531, 1}, {0xfa03, 2532, 1}, {0xfa04, 2533, 1},
+    {0xfa05, 2534, 1}, {0xfa06, 2535, 1}, {0xfa07, 2536, 1}, {0xfa08, 2537, 1},
+    {0xfa09, 2538, 1}, {0xfa0a, 2539, 1}, {0xfa0b, 2540, 1}, {0xfa0c, 2541, 1},
+    {0xfa0d, 2542, 1}, {0xfa10, 2543, 1}, {0xfa12, 2544, 1}, {0xfa15, 2545, 1},
+    {0xfa16, 2546, 1}, {0xfa17, 2547, 1}, {0xfa18, 2548, 1}, {0xfa19, 2549, 1},
+    {0xfa1a, 2550, 1}, {0xfa1b, 2551, 1}, {0xfa1c, 2552, 1}, {0xfa1d, 2553, 1},
+    {0xfa1e, 2554, 1}, {0xfa20, 2555, 1}, {0xfa22, 2556, 1}, {0xfa25, 2557, 1},
+    {0xfa26, 2558, 1}, {0xfa2a, 2559, 1}, {0xfa2b, 2560, 1}, {0xfa2c, 2561, 1},
+    {0xfa2d, 2562, 1}, {0xfa2e, 2563, 1}, {0xfa2f, 2564, 1}, {0xfa30, 2565, 1},
+    {0xfa31, 2566, 1}, {0xfa32, 2567, 1}, {0xfa33, 2568, 1}, {0xfa34, 2569, 1},
+    {0xfa35, 2570, 1}, {0xfa36, 2571, 1}, {0xfa37, 2572, 1}, {0xfa38, 2573, 1},
+    {0xfa39, 2574, 1}, {0xfa3a, 2575, 1}, {0xfa3b, 2576, 1}, {0xfa3c, 2577, 1},
+    {0xfa3d, 2578, 1}, {0xfa3e, 2579, 1}, {0xfa3f, 2580, 1}, {0xfa40, 2581, 1},
+    {0xfa41, 2582, 1}, {0xfa42, 2583, 1}, {0xfa43, 2584, 1}, {0xfa44, 2585, 1},
+    {0xfa45, 2586, 1}, {0xfa46, 2587, 1}, {0xfa47, 2588, 1}, {0xfa48, 2589, 1},
+    {0xfa49, 2590, 1}, {0xfa4a, 2591, 1}, {0xfa4b, 2592, 1}, {0xfa4c, 2593, 1},
+    {0xfa4d, 2594, 1}, {0xfa4e, 2595, 1}, {0xfa4f, 2596, 1}, {0xfa50, 2597, 1},
+    {0xfa51, 2598, 1}, {0xfa52, 2599, 1}, {0xfa53, 2600, 1}, {0xfa54, 2601, 1},
+    {0xfa55, 2602, 1}, {0xfa56, 2603, 1}, {0xfa57, 2604, 1}, {0xfa58, 2605, 1},
+    {0xfa59, 2606, 1}, {0xfa5a, 2607, 1}, {0xfa5b, 2608, 1}, {0xfa5c, 2609, 1},
+    {0xfa5d, 2610, 1}, {0xfa5e, 2611, 1}, {0xfa5f, 2612, 1}, {0xfa60, 2613, 1},
+    {0xfa61, 2614, 1}, {0xfa62, 2615, 1}, {0xfa63, 2616, 1}, {0xfa64, 2617, 1},
+    {0xfa65, 2618, 1}, {0xfa66, 2619, 1}, {0xfa67, 2620, 1}, {0xfa68, 2621, 1},
+    {0xfa69, 2622, 1}, {0xfa6a, 2623, 1}, {0xfa6b, 2624, 1}, {0xfa6c, 2625, 1},
+    {0xfa6d, 2626, 1}, {0xfa70, 2627, 1}, {0xfa71, 2628, 1}, {0xfa72, 2629, 1},
+    {0xfa73, 2630, 1}, {0xfa74, 2631, 1}, {0xfa75, 2632, 1}, {0xfa76, 2633, 1},
+    {0xfa77, 2634, 1}, {0xfa78, 2635, 1}, {0xfa79, 2636, 1}, {0xfa7a, 2637, 1},
+    {0xfa7b, 2638, 1}, {0xfa7c, 2639, 1}, {0xfa7d, 2640, 1}, {0xfa7e, 2641, 1},
+    {0xfa7f, 2642, 1}, {0xfa80, 2643, 1}, {0xfa81, 2644, 1}, {0xfa82, 2645, 1},
+    {0xfa83, 2646, 1}, {0xfa84, 2647, 1}, {0xfa85, 2648, 1}, {0xfa86, 2649, 1},
+    {0xfa87, 2650, 1}, {0xfa88, 2651, 1}, {0xfa89, 2652, 1}, {0xfa8a, 2653, 1},
+    {0xfa8b, 2654, 1}, {0xfa8c, 2655, 1}, {0xfa8d, 2656, 1}, {0xfa8e, 2657, 1},
+    {0xfa8f, 2658, 1}, {0xfa90, 2659, 1}, {0xfa91, 2660, 1}, {0xfa92, 2661, 1},
+    {0xfa93, 2662, 1}, {0xfa94, 2663, 1}, {0xfa95, 2664, 1}, {0xfa96, 2665, 1},
+    {0xfa97, 2666, 1}, {0xfa98, 2667, 1}, {0xfa99, 2668, 1}, {0xfa9a, 2669, 1},
+    {0xfa9b, 2670, 1}, {0xfa9c, 2671, 1}, {0xfa9d, 2672, 1}, {0xfa9e, 2673, 1},
+    {0xfa9f, 2674, 1}, {0xfaa0, 2675, 1}, {0xfaa1, 2676, 1}, {0xfaa2, 2677, 1},
+    {0xfaa3, 2678, 1}, {0xfaa4, 2679, 1}, {0xfaa5, 2680, 1}, {0xfaa6, 2681, 1},
+    {0xfaa7, 2682, 1}, {0xfaa8, 2683, 1}, {0xfaa9, 2684, 1}, {0xfaaa, 2685, 1},
+    {0xfaab, 2686, 1}, {0xfaac, 2687, 1}, {0xfaad, 2688, 1}, {0xfaae, 2689, 1},
+    {0xfaaf, 2690, 1}, {0xfab0, 2691, 1}, {0xfab1, 2692, 1}, {0xfab2, 2693, 1},
+    {0xfab3, 2694, 1}, {0xfab4, 2695, 1}, {0xfab5, 2696, 1}, {0xfab6, 2697, 1},
+    {0xfab7, 2698, 1}, {0xfab8, 2699, 1}, {0xfab9, 2700, 1}, {0xfaba, 2701, 1},
+    {0xfabb, 2702, 1}, {0xfabc, 2703, 1}, {0xfabd, 2704, 1}, {0xfabe, 2705, 1},
+    {0xfabf, 2706, 1}, {0xfac0, 2707, 1}, {0xfac1, 2708, 1}, {0xfac2, 2709, 1},
+    {0xfac3, 2710, 1}, {0xfac4, 2711, 1}, {0xfac5, 2712, 1}, {0xfac6, 2713, 1},
+    {0xfac7, 2714, 1}, {0xfac8, 2715, 1}, {0xfac9, 2716, 1}, {0xfaca, 2717, 1},
+    {0xfacb, 2718, 1}, {0xfacc, 2719, 1}, {0xfacd, 2720, 1}, {0xface, 2721, 1},
+    {0xfacf, 2722, 1}, {0xfad0, 2723, 1}, {0xfad1, 2724, 1}, {0xfad2, 2725, 1},
+    {0xfad3, 2726, 1}, {0xfad4, 2727, 1}, {0xfad5, 2728, 1}, {0xfad6, 2729, 1},
+    {0xfad7, 2730, 1}, {0xfad8, 2731, 1}, {0xfad9, 2732, 1}, {0xfb1d, 2733, 2},
+    {0xfb1f, 2735, 2}, {0xfb2a, 2737, 2}, {0xfb2b, 2739, 2}, {0xfb2c, 2741, 3},
+    {0xfb2d, 2744, 3}, {0xfb2e, 2747, 2}, {0xfb2f, 2749, 2}, {0xfb30, 2751, 2},
+    {0xfb31, 2753, 2}, {0xfb32, 2755, 2}, {0xfb33, 2757, 2}, {0xfb34, 2759, 2},
+    {0xfb35, 2761, 2}, {0xfb36, 2763, 2}, {0xfb38, 2765, 2}, {0xfb39, 2767, 2},
+    {0xfb3a, 2769, 2}, {0xfb3b, 2771, 2}, {0xfb3c, 2773, 2}, {0xfb3e, 2775, 2},
+    {0xfb40, 2777, 2}, {0xfb41, 2779, 2}, {0xfb43, 2781, 2}, {0xfb44, 2783, 2},
+    {0xfb46, 2785, 2}, {0xfb47, 2787, 2}, {0xfb48, 2789, 2}, {0xfb49, 2791, 2},
+    {0xfb4a, 2793, 2}, {0xfb4b, 2795, 2}, {0xfb4c, 2797, 2}, {0xfb4d, 2799, 2},
+    {0xfb4e, 2801, 2}, {0x1109a, 2803, 2}, {0x1109c, 2805, 2}, {0x110ab, 2807, 2},
+    {0x1112e, 2809, 2}, {0x1112f, 2811, 2}, {0x1134b, 2813, 2}, {0x1134c, 2815, 2},
+    {0x114bb, 2817, 2}, {0x114bc, 2819, 2}, {0x114be, 2821, 2}, {0x115ba, 2823, 2},
+    {0x115bb, 2825, 2}, {0x11938, 2827, 2}, {0x1d15e, 2829, 2}, {0x1d15f, 2831, 2},
+    {0x1d160, 2833, 3}, {0x1d161, 2836, 3}, {0x1d162, 2839, 3}, {0x1d163, 2842, 3},
+    {0x1d164, 2845, 3}, {0x1d1bb, 2848, 2}, {0x1d1bc, 2850, 2}, {0x1d1bd, 2852, 3},
+    {0x1d1be, 2855, 3}, {0x1d1bf, 2858, 3}, {0x1d1c0, 2861, 3}, {0x2f800, 2864, 1},
+    {0x2f801, 2865, 1}, {0x2f802, 2866, 1}, {0x2f803, 2867, 1}, {0x2f804, 2868, 1},
+    {0x2f805, 2869, 1}, {0x2f806, 2870, 1}, {0x2f807, 2871, 1}, {0x2f808, 2872, 1},
+    {0x2f809, 2873, 1}, {0x2f80a, 2874, 1}, {0x2f80b, 2875, 1}, {0x2f80c, 2876, 1},
+    {0x2f80d, 2877, 1}, {0x2f80e, 2878, 1}, {0x2f80f, 2879, 1}, {0x2f810, 2880, 1},
+    {0x2f811, 2881, 1}, {0x2f812, 2882, 1}, {0x2f813, 2883, 1}, {0x2f814, 2884, 1},
+    {0x2f815, 2885, 1}, {0x2f816, 2886, 1}, {0x2f817, 2887, 1}, {0x2f818, 2888, 1},
+    {0x2f819, 2889, 1}, {0x2f81a, 2890, 1}, {0x2f81b, 2891, 1}, {0x2f81c, 2892, 1},
+    {0x2f81d, 2893, 1}, {0x2f81e, 2894, 1}, {0x2f81f, 2895, 1}, {0x2f820, 2896, 1},
+    {0x2f821, 2897, 1}, {0x2f822, 2898, 1}, {0x2f823, 2899, 1}, {0x2f824, 2900, 1},
+    {0x2f825, 2901, 1}, {0x2f826, 2902, 1}, {0x2f827, 2903, 1}, {0x2f828, 2904, 1},
+    {0x2f829, 2905, 1}, {0x2f82a, 2906, 1}, {0x2f82b, 2907, 1}, {0x2f82c, 2908, 1},
+    {0x2f82d, 2909, 1}, {0x2f82e, 2910, 1}, {0x2f82f, 2911, 1}, {0x2f830, 2912, 1},
+    {0x2f831, 2913, 1}, {0x2f832, 2914, 1}, {0x2f833, 2915, 1}, {0x2f834, 2916, 1},
+    {0x2f835, 2917, 1}, {0x2f836, 2918, 1}, {0x2f837, 2919, 1}, {0x2f838, 2920, 1},
+    {0x2f839, 2921, 1}, {0x2f83a, 2922, 1}, {0x2f83b, 2923, 1}, {0x2f83c, 2924, 1},
+    {0x2f83d, 2925, 1}, {0x2f83e, 2926, 1}, {0x2f83f, 2927, 1}, {0x2f840, 2928, 1},
+    {0x2f841, 2929, 1}, {0x2f842, 2930, 1}, {0x2f843, 2931, 1}, {0x2f844, 2932, 1},
+    {0x2f845, 2933, 1}, {0x2f846, 2934, 1}, {0x2f847, 2935, 1}, {0x2f848, 2936, 1},
+    {0x2f849, 2937, 1}, {0x2f84a, 2938, 1}, {0x2f84b, 2939, 1}, {0x2f84c, 2940, 1},
+    {0x2f84d, 2941, 1}, {0x2f84e, 2942, 1}, {0x2f84f, 2943, 1}, {0x2f850, 2944, 1},
+    {0x2f851, 2945, 1}, {0x2f852, 2946, 1}, {0x2f853, 2947, 1}, {0x2f854, 2948, 1},
+    {0x2f855, 2949, 1}, {0x2f856, 2950, 1}, {0x2f857, 2951, 1}, {0x2f858, 2952, 1},
+    {0x2f859, 2953, 1}, {0x2f85a, 2954, 1}, {0x2f85b, 2955, 1}, {0x2f85c, 2956, 1},
+    {0x2f85d, 2957, 1}, {0x2f85e, 2958, 1}, {0x2f85f, 2959, 1}, {0x2f860, 2960, 1},
+    {0x2f861, 2961, 1}, {0x2f862, 2962, 1}, {0x2f863, 2963, 1}, {0x2f864, 2964, 1},
+    {0x2f865, 2965, 1}, {0x2f866, 2966, 1}, {0x2f867, 2967, 1}, {0x2f868, 2968, 1},
+    {0x2f869, 2969, 1}, {0x2f86a, 2970, 1}, {0x2f86b, 2971, 1}, {0x2f86c, 2972, 1},
+    {0x2f86d, 2973, 1}, {0x2f86e, 2974, 1}, {0x2f86f, 2975, 1}, {0x2f870, 2976, 1},
+    {0x2f871, 2977, 1}, {0x2f872, 2978, 1}, {0x2f873, 2979, 1}, {0x2f874, 2980, 1},
+    {0x2f875, 2981, 1}, {0x2f876, 2982, 1}, {0x2f877, 2983, 1}, {0x2f878, 2984, 1},
+    {0x2f879, 2985, 1}, {0x2f87a, 2986, 1}, {0x2f87b, 2987, 1}, {0x2f87c, 2988, 1},
+    {0x2f87d, 2989, 1}, {0x2f87e, 2990, 1}, {0x2f87f, 2991, 1}, {0x2f880, 2992, 1},
+    {0x2f881, 2993, 1}, {0x2f882, 2994, 1}, {0x2f883, 2995, 1}, {0x2f884, 2996, 1},
+    {0x2f885, 2997, 1}, {0x2f886, 2998, 1}, {0x2f887, 2999, 1}, {0x2f888, 3000, 1},
+    {0x2f889, 3001, 1}, {0x2f88a, 3002, 1}, {0x2f88b, 3003, 1}, {0x2f88c, 3004, 1},
+    {0x2f88d, 3005, 1}, {0x2f88e, 3006, 1}, {0x2f88f, 3007, 1}, {0x2f890, 3008, 1},
+    {0x2f891, 3009, 1}, {0x2f892, 3010, 1}, {0x2f893, 3011, 1}, {0x2f894, 3012, 1},
+    {0x2f895, 3013, 1}, {0x2f896, 3014, 1}, {0x2f897, 3015, 1}, {0x2f898, 3016, 1},
+    {0x2f899, 3017, 1}, {0x2f89a, 3018, 1}, {0x2f89b, 3019, 1}, {0x2f89c, 3020, 1},
+    {0x2f89d, 3021, 1}, {0x2f89e, 3022, 1}, {0x2f89f, 3023, 1}, {0x2f8a0, 3024, 1},
+    {0x2f8a1, 3025, 1}, {0x2f8a2, 3026, 1}, {0x2f8a3, 3027, 1}, {0x2f8a4, 3028, 1},
+    {0x2f8a5, 3029, 1}, {0x2f8a6, 3030, 1}, {0x2f8a7, 3031, 1}, {0x2f8a8, 3032, 1},
+    {0x2f8a9, 3033, 1}, {0x2f8aa, 3034, 1}, {0x2f8ab, 3035, 1}, {0x2f8ac, 3036, 1},
+    {0x2f8ad, 3037, 1}, {0x2f8ae, 3038, 1}, {0x2f8af, 3039, 1}, {0x2f8b0, 3040, 1},
+    {0x2f8b1, 3041, 1}, {0x2f8b2, 3042, 1}, {0x2f8b3, 3043, 1}, {0x2f8b4, 3044, 1},
+    {0x2f8b5, 3045, 1}, {0x2f8b6, 3046, 1}, {0x2f8b7, 3047, 1}, {0x2f8b8, 3048, 1},
+    {0x2f8b9, 3049, 1}, {0x2f8ba, 3050, 1}, {0x2f8bb, 3051, 1}, {0x2f8bc, 3052, 1},
+    {0x2f8bd, 3053, 1}, {0x2f8be, 3054, 1}, {0x2f8bf, 3055, 1}, {0x2f8c0, 3056, 1},
+    {0x2f8c1, 3057, 1}, {0x2f8c2, 3058, 1}, {0x2f8c3, 3059, 1}, {0x2f8c4, 3060, 1},
+    {0x2f8c5, 3061, 1}, {0x2f8c6, 3062, 1}, {0x2f8c7, 3063, 1}, {0x2f8c8, 3064, 1},
+    {0x2f8c9, 3065, 1}, {0x2f8ca, 3066, 1}, {0x2f8cb, 3067, 1}, {0x2f8cc, 3068, 1},
+    {0x2f8cd, 3069, 1}, {0x2f8ce, 3070, 1}, {0x2f8cf, 3071, 1}, {0x2f8d0, 3072, 1},
+    {0x2f8d1, 3073, 1}, {0x2f8d2, 3074, 1}, {0x2f8d3, 3075, 1}, {0x2f8d4, 3076, 1},
+    {0x2f8d5, 3077, 1}, {0x2f8d6, 3078, 1}, {0x2f8d7, 3079, 1}, {0x2f8d8, 3080, 1},
+    {0x2f8d9, 3081, 1}, {0x2f8da, 3082, 1}, {0x2f8db, 3083, 1}, {0x2f8dc, 3084, 1},
+    {0x2f8dd, 3085, 1}, {0x2f8de, 3086, 1}, {0x2f8df, 3087, 1}, {0x2f8e0, 3088, 1},
+    {0x2f8e1, 3089, 1}, {0x2f8e2, 3090, 1}, {0x2f8e3, 3091, 1}, {0x2f8e4, 3092, 1},
+    {0x2f8e5, 3093, 1}, {0x2f8e6, 3094, 1}, {0x2f8e7, 3095, 1}, {0x2f8e8, 3096, 1},
+    {0x2f8e9, 3097, 1}, {0x2f8ea, 3098, 1}, {0x2f8eb, 3099, 1}, {0x2f8ec, 3100, 1},
+    {0x2f8ed, 3101, 1}, {0x2f8ee, 3102, 1}, {0x2f8ef, 3103, 1}, {0x2f8f0, 3104, 1},
+    {0x2f8f1, 3105, 1}, {0x2f8f2, 3106, 1}, {0x2f8f3, 3107, 1}, {0x2f8f4, 3108, 1},
+    {0x2f8f5, 3109, 1}, {0x2f8f6, 3110, 1}, {0x2f8f7, 3111, 1}, {0x2f8f8, 3112, 1},
+    {0x2f8f9, 3113, 1}, {0x2f8fa, 3114, 1}, {0x2f8fb, 3115, 1}, {0x2f8fc, 3116, 1},
+    {0x2f8fd, 3117, 1}, {0x2f8fe, 3118, 1}, {0x2f8ff, 3119, 1}, {0x2f900, 3120, 1},
+    {0x2f901, 3121, 1}, {0x2f902, 3122, 1}, {0x2f903, 3123, 1}, {0x2f904, 3124, 1},
+    {0x2f905, 3125, 1}, {0x2f906, 3126, 1}, {0x2f907, 3127, 1}, {0x2f908, 3128, 1},
+    {0x2f909, 3129, 1}, {0x2f90a, 3130, 1}, {0x2f90b, 3131, 1}, {0x2f90c, 3132, 1},
+    {0x2f90d, 3133, 1}, {0x2f90e, 3134, 1}, {0x2f90f, 3135, 1}, {0x2f910, 3136, 1},
+    {0x2f911, 3137, 1}, {0x2f912, 3138, 1}, {0x2f913, 3139, 1}, {0x2f914, 3140, 1},
+    {0x2f915, 3141, 1}, {0x2f916, 3142, 1}, {0x2f917, 3143, 1}, {0x2f918, 3144, 1},
+    {0x2f919, 3145, 1}, {0x2f91a, 3146, 1}, {0x2f91b, 3147, 1}, {0x2f91c, 3148, 1},
+    {0x2f91d, 3149, 1}, {0x2f91e, 3150, 1}, {0x2f91f, 3151, 1}, {0x2f920, 3152, 1},
+    {0x2f921, 3153, 1}, {0x2f922, 3154, 1}, {0x2f923, 3155, 1}, {0x2f924, 3156, 1},
+    {0x2f925, 3157, 1}, {0x2f926, 3158, 1}, {0x2f927, 3159, 1}, {0x2f928, 3160, 1},
+    {0x2f929, 3161, 1}, {0x2f92a, 3162, 1}, {0x2f92b, 3163, 1}, {0x2f92c, 3164, 1},
+    {0x2f92d, 3165, 1}, {0x2f92e, 3166, 1}, {0x2f92f, 3167, 1}, {0x2f930, 3168, 1},
+    {0x2f931, 3169, 1}, {0x2f932, 3170, 1}, {0x2f933, 3171, 1}, {0x2f934, 3172, 1},
+    {0x2f935, 3173, 1}, {0x2f936, 3174, 1}, {0x2f937, 3175, 1}, {0x2f938, 3176, 1},
+    {0x2f939, 3177, 1}, {0x2f93a, 3178, 1}, {0x2f93b, 3179, 1}, {0x2f93c, 3180, 1},
+    {0x2f93d, 3181, 1}, {0x2f93e, 3182, 1}, {0x2f93f, 3183, 1}, {0x2f940, 3184, 1},
+    {0x2f941, 3185, 1}, {0x2f942, 3186, 1}, {0x2f943, 3187, 1}, {0x2f944, 3188, 1},
+    {0x2f945, 3189, 1}, {0x2f946, 3190, 1}, {0x2f947, 3191, 1}, {0x2f948, 3192, 1},
+    {0x2f949, 3193, 1}, {0x2f94a, 3194, 1}, {0x2f94b, 3195, 1}, {0x2f94c, 3196, 1},
+    {0x2f94d, 3197, 1}, {0x2f94e, 3198, 1}, {0x2f94f, 3199, 1}, {0x2f950, 3200, 1},
+    {0x2f951, 3201, 1}, {0x2f952, 3202, 1}, {0x2f953, 3203, 1}, {0x2f954, 3204, 1},
+    {0x2f955, 3205, 1}, {0x2f956, 3206, 1}, {0x2f957, 3207, 1}, {0x2f958, 3208, 1},
+    {0x2f959, 3209, 1}, {0x2f95a, 3210, 1}, {0x2f95b, 3211, 1}, {0x2f95c, 3212, 1},
+    {0x2f95d, 3213, 1}, {0x2f95e, 3214, 1}, {0x2f95f, 3215, 1}, {0x2f960, 3216, 1},
+    {0x2f961, 3217, 1}, {0x2f962, 3218, 1}, {0x2f963, 3219, 1}, {0x2f964, 3220, 1},
+    {0x2f965, 3221, 1}, {0x2f966, 3222, 1}, {0x2f967, 3223, 1}, {0x2f968, 3224, 1},
+    {0x2f969, 3225, 1}, {0x2f96a, 3226, 1}, {0x2f96b, 3227, 1}, {0x2f96c, 3228, 1},
+    {0x2f96d, 3229, 1}, {0x2f96e, 3230, 1}, {0x2f96f, 3231, 1}, {0x2f970, 3232, 1},
+    {0x2f971, 3233, 1}, {0x2f972, 3234, 1}, {0x2f973, 3235, 1}, {0x2f974, 3236, 1},
+    {0x2f975, 3237, 1}, {0x2f976, 3238, 1}, {0x2f977, 3239, 1}, {0x2f978, 3240, 1},
+    {0x2f979, 3241, 1}, {0x2f97a, 3242, 1}, {0x2f97b, 3243, 1}, {0x2f97c, 3244, 1},
+    {0x2f97d, 3245, 1}, {0x2f97e, 3246, 1}, {0x2f97f, 3247, 1}, {0x2f980, 3248, 1},
+    {0x2f981, 3249, 1}, {0x2f982, 3250, 1}, {0x2f983, 3251, 1}, {0x2f984, 3252, 1},
+    {0x2f985, 3253, 1}, {0x2f986, 3254, 1}, {0x2f987, 3255, 1}, {0x2f988, 3256, 1},
+    {0x2f989, 3257, 1}, {0x2f98a, 3258, 1}, {0x2f98b, 3259, 1}, {0x2f98c, 3260, 1},
+    {0x2f98d, 3261, 1}, {0x2f98e, 3262, 1}, {0x2f98f, 3263, 1}, {0x2f990, 3264, 1},
+    {0x2f991, 3265, 1}, {0x2f992, 3266, 1}, {0x2f993, 3267, 1}, {0x2f994, 3268, 1},
+    {0x2f995, 3269, 1}, {0x2f996, 3270, 1}, {0x2f997, 3271, 1}, {0x2f998, 3272, 1},
+    {0x2f999, 3273, 1}, {0x2f99a, 3274, 1}, {0x2f99b, 3275, 1}, {0x2f99c, 3276, 1},
+    {0x2f99d, 3277, 1}, {0x2f99e, 3278, 1}, {0x2f99f, 3279, 1}, {0x2f9a0, 3280, 1},
+    {0x2f9a1, 3281, 1}, {0x2f9a2, 3282, 1}, {0x2f9a3, 3283, 1}, {0x2f9a4, 3284, 1},
+    {0x2f9a5, 3285, 1}, {0x2f9a6, 3286, 1}, {0x2f9a7, 3287, 1}, {0x2f9a8, 3288, 1},
+    {0x2f9a9, 3289, 1}, {0x2f9aa, 3290, 1}, {0x2f9ab, 3291, 1}, {0x2f9ac, 3292, 1},
+    {0x2f9ad, 3293, 1}, {0x2f9ae, 3294, 1}, {0x2f9af, 3295, 1}, {0x2f9b0, 3296, 1},
+    {0x2f9b1, 3297, 1}, {0x2f9b2, 3298, 1}, {0x2f9b3, 3299, 1}, {0x2f9b4, 3300, 1},
+    {0x2f9b5, 3301, 1}, {0x2f9b6, 3302, 1}, {0x2f9b7, 3303, 1}, {0x2f9b8, 3304, 1},
+    {0x2f9b9, 3305, 1}, {0x2f9ba, 3306, 1}, {0x2f9bb, 3307, 1}, {0x2f9bc, 3308, 1},
+    {0x2f9bd, 3309, 1}, {0x2f9be, 3310, 1}, {0x2f9bf, 3311, 1}, {0x2f9c0, 3312, 1},
+    {0x2f9c1, 3313, 1}, {0x2f9c2, 3314, 1}, {0x2f9c3, 3315, 1}, {0x2f9c4, 3316, 1},
+    {0x2f9c5, 3317, 1}, {0x2f9c6, 3318, 1}, {0x2f9c7, 3319, 1}, {0x2f9c8, 3320, 1},
+    {0x2f9c9, 3321, 1}, {0x2f9ca, 3322, 1}, {0x2f9cb, 3323, 1}, {0x2f9cc, 3324, 1},
+    {0x2f9cd, 3325, 1}, {0x2f9ce, 3326, 1}, {0x2f9cf, 3327, 1}, {0x2f9d0, 3328, 1},
+    {0x2f9d1, 3329, 1}, {0x2f9d2, 3330, 1}, {0x2f9d3, 3331, 1}, {0x2f9d4, 3332, 1},
+    {0x2f9d5, 3333, 1}, {0x2f9d6, 3334, 1}, {0x2f9d7, 3335, 1}, {0x2f9d8, 3336, 1},
+    {0x2f9d9, 3337, 1}, {0x2f9da, 3338, 1}, {0x2f9db, 3339, 1}, {0x2f9dc, 3340, 1},
+    {0x2f9dd, 3341, 1}, {0x2f9de, 3342, 1}, {0x2f9df, 3343, 1}, {0x2f9e0, 3344, 1},
+    {0x2f9e1, 3345, 1}, {0x2f9e2, 3346, 1}, {0x2f9e3, 3347, 1}, {0x2f9e4, 3348, 1},
+    {0x2f9e5, 3349, 1}, {0x2f9e6, 3350, 1}, {0x2f9e7, 3351, 1}, {0x2f9e8, 3352, 1},
+    {0x2f9e9, 3353, 1}, {0x2f9ea, 3354, 1}, {0x2f9eb, 3355, 1}, {0x2f9ec, 3356, 1},
+    {0x2f9ed, 3357, 1}, {0x2f9ee, 3358, 1}, {0x2f9ef, 3359, 1}, {0x2f9f0, 3360, 1},
+    {0x2f9f1, 3361, 1}, {0x2f9f2, 3362, 1}, {0x2f9f3, 3363, 1}, {0x2f9f4, 3364, 1},
+    {0x2f9f5, 3365, 1}, {0x2f9f6, 3366, 1}, {0x2f9f7, 3367, 1}, {0x2f9f8, 3368, 1},
+    {0x2f9f9, 3369, 1}, {0x2f9fa, 3370, 1}, {0x2f9fb, 3371, 1}, {0x2f9fc, 3372, 1},
+    {0x2f9fd, 3373, 1}, {0x2f9fe, 3374, 1}, {0x2f9ff, 3375, 1}, {0x2fa00, 3376, 1},
+    {0x2fa01, 3377, 1}, {0x2fa02, 3378, 1}, {0x2fa03, 3379, 1}, {0x2fa04, 3380, 1},
+    {0x2fa05, 3381, 1}, {0x2fa06, 3382, 1}, {0x2fa07, 3383, 1}, {0x2fa08, 3384, 1},
+    {0x2fa09, 3385, 1}, {0x2fa0a, 3386, 1}, {0x2fa0b, 3387, 1}, {0x2fa0c, 3388, 1},
+    {0x2fa0d, 3389, 1}, {0x2fa0e, 3390, 1}, {0x2fa0f, 3391, 1}, {0x2fa10, 3392, 1},
+    {0x2fa11, 3393, 1}, {0x2fa12, 3394, 1}, {0x2fa13, 3395, 1}, {0x2fa14, 3396, 1},
+    {0x2fa15, 3397, 1}, {0x2fa16, 3398, 1}, {0x2fa17, 3399, 1}, {0x2fa18, 3400, 1},
+    {0x2fa19, 3401, 1}, {0x2fa1a, 3402, 1}, {0x2fa1b, 3403, 1}, {0x2fa1c, 3404, 1},
+    {0x2fa1d, 3405, 1},
+};
+
+inline constexpr std::uint32_t decomposition_pool[3406] = {
+    0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41, 0x303, 0x41, 0x308,
+    0x41, 0x30a, 0x43, 0x327, 0x45, 0x300, 0x45, 0x301, 0x45, 0x302,
+    0x45, 0x308, 0x49, 0x300, 0x49, 0x301, 0x49, 0x302, 0x49, 0x308,
+    0x4e, 0x303, 0x4f, 0x300, 0x4f, 0x301, 0x4f, 0x302, 0x4f, 0x303,
+    0x4f, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302, 0x55, 0x308,
+    0x59, 0x301, 0x61, 0x300, 0x61, 0x301, 0x61, 0x302, 0x61, 0x303,
+    0x61, 0x308, 0x61, 0x30a, 0x63, 0x327, 0x65, 0x300, 0x65, 0x301,
+    0x65, 0x302, 0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302,
+    0x69, 0x308, 0x6e, 0x303, 0x6f, 0x300, 0x6f, 0x301, 0x6f, 0x302,
+    0x6f, 0x303, 0x6f, 0x308, 0x75, 0x300, 0x75, 0x301, 0x75, 0x302,
+    0x75, 0x308, 0x79, 0x301, 0x79, 0x308, 0x41, 0x304, 0x61, 0x304,
+    0x41, 0x306, 0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301,
+    0x63, 0x301, 0x43, 0x302, 0x63, 0x302, 0x43, 0x307, 0x63, 0x307,
+    0x43, 0x30c, 0x63, 0x30c, 0x44, 0x30c, 0x64, 0x30c, 0x45, 0x304,
+    0x65, 0x304, 0x45, 0x306, 0x65, 0x306, 0x45, 0x307, 0x65, 0x307,
+    0x45, 0x328, 0x65, 0x328, 0x45, 0x30c, 0x65, 0x30c, 0x47, 0x302,
+    0x67, 0x302, 0x47, 0x306, 0x67, 0x306, 0x47, 0x307, 0x67, 0x307,
+    0x47, 0x327, 0x67, 0x327, 0x48, 0x302, 0x68, 0x302, 0x49, 0x303,
+    0x69, 0x303, 0x49, 0x304, 0x69, 0x304, 0x49, 0x306, 0x69, 0x306,
+    0x49, 0x328, 0x69, 0x328, 0x49, 0x307, 0x4a, 0x302, 0x6a, 0x302,
+    0x4b, 0x327, 0x6b, 0x327, 0x4c, 0x301, 0x6c, 0x301, 0x4c, 0x327,
+    0x6c, 0x327, 0x4c, 0x30c, 0x6c, 0x30c, 0x4e, 0x301, 0x6e, 0x301,
+    0x4e, 0x327, 0x6e, 0x327, 0x4e, 0x30c, 0x6e, 0x30c, 0x4f, 0x304,
+    0x6f, 0x304, 0x4f, 0x306, 0x6f, 0x306, 0x4f, 0x30b, 0x6f, 0x30b,
+    0x52, 0x301, 0x72, 0x301, 0x52, 0x327, 0x72, 0x327, 0x52, 0x30c,
+    0x72, 0x30c, 0x53, 0x301, 0x73, 0x301, 0x53, 0x302, 0x73, 0x302,
+    0x53, 0x327, 0x73, 0x327, 0x53, 0x30c, 0x73, 0x30c, 0x54, 0x327,
+    0x74, 0x327, 0x54, 0x30c, 0x74, 0x30c, 0x55, 0x303, 0x75, 0x303,
+    0x55, 0x304, 0x75, 0x304, 0x55, 0x306, 0x75, 0x306, 0x55, 0x30a,
+    0x75, 0x30a, 0x55, 0x30b, 0x75, 0x30b, 0x55, 0x328, 0x75, 0x328,
+    0x57, 0x302, 0x77, 0x302, 0x59, 0x302, 0x79, 0x302, 0x59, 0x308,
+    0x5a, 0x301, 0x7a, 0x301, 0x5a, 0x307, 0x7a, 0x307, 0x5a, 0x30c,
+    0x7a, 0x30c, 0x4f, 0x31b, 0x6f, 0x31b, 0x55, 0x31b, 0x75, 0x31b,
+    0x41, 0x30c, 0x61, 0x30c, 0x49, 0x30c, 0x69, 0x30c, 0x4f, 0x30c,
+    0x6f, 0x30c, 0x55, 0x30c, 0x75, 0x30c, 0x55, 0x308, 0x304, 0x75,
+    0x308, 0x304, 0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55, 0x308,
+    0x30c, 0x75, 0x308, 0x30c, 0x55, 0x308, 0x300, 0x75, 0x308, 0x300,
+    0x41, 0x308, 0x304, 0x61, 0x308, 0x304, 0x41, 0x307, 0x304, 0x61,
+    0x307, 0x304, 0xc6, 0x304, 0xe6, 0x304, 0x47, 0x30c, 0x67, 0x30c,
+    0x4b, 0x30c, 0x6b, 0x30c, 0x4f, 0x328, 0x6f, 0x328, 0x4f, 0x328,
+    0x304, 0x6f, 0x328, 0x304, 0x1b7, 0x30c, 0x292, 0x30c, 0x6a, 0x30c,
+    0x47, 0x301, 0x67, 0x301, 0x4e, 0x300, 0x6e, 0x300, 0x41, 0x30a,
+    0x301, 0x61, 0x30a, 0x301, 0xc6, 0x301, 0xe6, 0x301, 0xd8, 0x301,
+    0xf8, 0x301, 0x41, 0x30f, 0x61, 0x30f, 0x41, 0x311, 0x61, 0x311,
+    0x45, 0x30f, 0x65, 0x30f, 0x45, 0x311, 0x65, 0x311, 0x49, 0x30f,
+    0x69, 0x30f, 0x49, 0x311, 0x69, 0x311, 0x4f, 0x30f, 0x6f, 0x30f,
+    0x4f, 0x311, 0x6f, 0x311, 0x52, 0x30f, 0x72, 0x30f, 0x52, 0x311,
+    0x72, 0x311, 0x55, 0x30f, 0x75, 0x30f, 0x55, 0x311, 0x75, 0x311,
+    0x53, 0x326, 0x73, 0x326, 0x54, 0x326, 0x74, 0x326, 0x48, 0x30c,
+    0x68, 0x30c, 0x41, 0x307, 0x61, 0x307, 0x45, 0x327, 0x65, 0x327,
+    0x4f, 0x308, 0x304, 0x6f, 0x308, 0x304, 0x4f, 0x303, 0x304, 0x6f,
+    0x303, 0x304, 0x4f, 0x307, 0x6f, 0x307, 0x4f, 0x307, 0x304, 0x6f,
+    0x307, 0x304, 0x59, 0x304, 0x79, 0x304, 0x300, 0x301, 0x313, 0x308,
+    0x301, 0x2b9, 0x3b, 0xa8, 0x301, 0x391, 0x301, 0xb7, 0x395, 0x301,
+    0x397, 0x301, 0x399, 0x301, 0x39f, 0x301, 0x3a5, 0x301, 0x3a9, 0x301,
+    0x3b9, 0x308, 0x301, 0x399, 0x308, 0x3a5, 0x308, 0x3b1, 0x301, 0x3b5,
+    0x301, 0x3b7, 0x301, 0x3b9, 0x301, 0x3c5, 0x308, 0x301, 0x3b9, 0x308,
+    0x3c5, 0x308, 0x3bf, 0x301, 0x3c5, 0x301, 0x3c9, 0x301, 0x3d2, 0x301,
+    0x3d2, 0x308, 0x415, 0x300, 0x415, 0x308, 0x413, 0x301, 0x406, 0x308,
+    0x41a, 0x301, 0x418, 0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306,
+    0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308, 0x43a, 0x301,
+    0x438, 0x300, 0x443, 0x306, 0x474, 0x30f, 0x475, 0x30f, 0x416, 0x306,
+    0x436, 0x306, 0x410, 0x306, 0x430, 0x306, 0x410, 0x308, 0x430, 0x308,
+    0x415, 0x306, 0x435, 0x306, 0x4d8, 0x308, 0x4d9, 0x308, 0x416, 0x308,
+    0x436, 0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304, 0x438, 0x304,
+    0x418, 0x308, 0x438, 0x308, 0x41e, 0x308, 0x43e, 0x308, 0x4e8, 0x308,
+    0x4e9, 0x308, 0x42d, 0x308, 0x44d, 0x308, 0x423, 0x304, 0x443, 0x304,
+    0x423, 0x308, 0x443, 0x308, 0x423, 0x30b, 0x443, 0x30b, 0x427, 0x308,
+    0x447, 0x308, 0x42b, 0x308, 0x44b, 0x308, 0x627, 0x653, 0x627, 0x654,
+    0x648, 0x654, 0x627, 0x655, 0x64a, 0x654, 0x6d5, 0x654, 0x6c1, 0x654,
+    0x6d2, 0x654, 0x928, 0x93c, 0x930, 0x93c, 0x933, 0x93c, 0x915, 0x93c,
+    0x916, 0x93c, 0x917, 0x93c, 0x91c, 0x93c, 0x921, 0x93c, 0x922, 0x93c,
+    0x92b, 0x93c, 0x92f, 0x93c, 0x9c7, 0x9be, 0x9c7, 0x9d7, 0x9a1, 0x9bc,
+    0x9a2, 0x9bc, 0x9af, 0x9bc, 0xa32, 0xa3c, 0xa38, 0xa3c, 0xa16, 0xa3c,
+    0xa17, 0xa3c, 0xa1c, 0xa3c, 0xa2b, 0xa3c, 0xb47, 0xb56, 0xb47, 0xb3e,
+    0xb47, 0xb57, 0xb21, 0xb3c, 0xb22, 0xb3c, 0xb92, 0xbd7, 0xbc6, 0xbbe,
+    0xbc7, 0xbbe, 0xbc6, 0xbd7, 0xc46, 0xc56, 0xcbf, 0xcd5, 0xcc6, 0xcd5,
+    0xcc6, 0xcd6, 0xcc6, 0xcc2, 0xcc6, 0xcc2, 0xcd5, 0xd46, 0xd3e, 0xd47,
+    0xd3e, 0xd46, 0xd57, 0xdd9, 0xdca, 0xdd9, 0xdcf, 0xdd9, 0xdcf, 0xdca,
+    0xdd9, 0xddf, 0xf42, 0xfb7, 0xf4c, 0xfb7, 0xf51, 0xfb7, 0xf56, 0xfb7,
+    0xf5b, 0xfb7, 0xf40, 0xfb5, 0xf71, 0xf72, 0xf71, 0xf74, 0xfb2, 0xf80,
+    0xfb3, 0xf80, 0xf71, 0xf80, 0xf92, 0xfb7, 0xf9c, 0xfb7, 0xfa1, 0xfb7,
+    0xfa6, 0xfb7, 0xfab, 0xfb7, 0xf90, 0xfb5, 0x1025, 0x102e, 0x1b05, 0x1b35,
+    0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+    0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35, 0x1b42, 0x1b35,
+    0x41, 0x325, 0x61, 0x325, 0x42, 0x307, 0x62, 0x307, 0x42, 0x323,
+    0x62, 0x323, 0x42, 0x331, 0x62, 0x331, 0x43, 0x327, 0x301, 0x63,
+    0x327, 0x301, 0x44, 0x307, 0x64, 0x307, 0x44, 0x323, 0x64, 0x323,
+    0x44, 0x331, 0x64, 0x331, 0x44, 0x327, 0x64, 0x327, 0x44, 0x32d,
+    0x64, 0x32d, 0x45, 0x304, 0x300, 0x65, 0x304, 0x300, 0x45, 0x304,
+    0x301, 0x65, 0x304, 0x301, 0x45, 0x32d, 0x65, 0x32d, 0x45, 0x330,
+    0x65, 0x330, 0x45, 0x327, 0x306, 0x65, 0x327, 0x306, 0x46, 0x307,
+    0x66, 0x307, 0x47, 0x304, 0x67, 0x304, 0x48, 0x307, 0x68, 0x307,
+    0x48, 0x323, 0x68, 0x323, 0x48, 0x308, 0x68, 0x308, 0x48, 0x327,
+    0x68, 0x327, 0x48, 0x32e, 0x68, 0x32e, 0x49, 0x330, 0x69, 0x330,
+    0x49, 0x308, 0x301, 0x69, 0x308, 0x301, 0x4b, 0x301, 0x6b, 0x301,
+    0x4b, 0x323, 0x6b, 0x323, 0x4b, 0x331, 0x6b, 0x331, 0x4c, 0x323,
+    0x6c, 0x323, 0x4c, 0x323, 0x304, 0x6c, 0x323, 0x304, 0x4c, 0x331,
+    0x6c, 0x331, 0x4c, 0x32d, 0x6c, 0x32d, 0x4d, 0x301, 0x6d, 0x301,
+    0x4d, 0x307, 0x6d, 0x307, 0x4d, 0x323, 0x6d, 0x323, 0x4e, 0x307,
+    0x6e, 0x307, 0x4e, 0x323, 0x6e, 0x323, 0x4e, 0x331, 0x6e, 0x331,
+    0x4e, 0x32d, 0x6e, 0x32d, 0x4f, 0x303, 0x301, 0x6f, 0x303, 0x301,
+    0x4f, 0x303, 0x308, 0x6f, 0x303, 0x308, 0x4f, 0x304, 0x300, 0x6f,
+    0x304, 0x300, 0x4f, 0x304, 0x301, 0x6f, 0x304, 0x301, 0x50, 0x301,
+    0x70, 0x301, 0x50, 0x307, 0x70, 0x307, 0x52, 0x307, 0x72, 0x307,
+    0x52, 0x323, 0x72, 0x323, 0x52, 0x323, 0x304, 0x72, 0x323, 0x304,
+    0x52, 0x331, 0x72, 0x331, 0x53, 0x307, 0x73, 0x307, 0x53, 0x323,
+    0x73, 0x323, 0x53, 0x301, 0x307, 0x73, 0x301, 0x307, 0x53, 0x30c,
+    0x307, 0x73, 0x30c, 0x307, 0x53, 0x323, 0x307, 0x73, 0x323, 0x307,
+    0x54, 0x307, 0x74, 0x307, 0x54, 0x323, 0x74, 0x323, 0x54, 0x331,
+    0x74, 0x331, 0x54, 0x32d, 0x74, 0x32d, 0x55, 0x324, 0x75, 0x324,
+    0x55, 0x330, 0x75, 0x330, 0x55, 0x32d, 0x75, 0x32d, 0x55, 0x303,
+    0x301, 0x75, 0x303, 0x301, 0x55, 0x304, 0x308, 0x75, 0x304, 0x308,
+    0x56, 0x303, 0x76, 0x303, 0x56, 0x323, 0x76, 0x323, 0x57, 0x300,
+    0x77, 0x300, 0x57, 0x301, 0x77, 0x301, 0x57, 0x308, 0x77, 0x308,
+    0x57, 0x307, 0x77, 0x307, 0x57, 0x323, 0x77, 0x323, 0x58, 0x307,
+    0x78, 0x307, 0x58, 0x308, 0x78, 0x308, 0x59, 0x307, 0x79, 0x307,
+    0x5a, 0x302, 0x7a, 0x302, 0x5a, 0x323, 0x7a, 0x323, 0x5a, 0x331,
+    0x7a, 0x331, 0x68, 0x331, 0x74, 0x308, 0x77, 0x30a, 0x79, 0x30a,
+    0x17f, 0x307, 0x41, 0x323, 0x61, 0x323, 0x41, 0x309, 0x61, 0x309,
+    0x41, 0x302, 0x301, 0x61, 0x302, 0x301, 0x41, 0x302, 0x300, 0x61,
+    0x302, 0x300, 0x41, 0x302, 0x309, 0x61, 0x302, 0x309, 0x41, 0x302,
+    0x303, 0x61, 0x302, 0x303, 0x41, 0x323, 0x302, 0x61, 0x323, 0x302,
+    0x41, 0x306, 0x301, 0x61, 0x306, 0x301, 0x41, 0x306, 0x300, 0x61,
+    0x306, 0x300, 0x41, 0x306, 0x309, 0x61, 0x306, 0x309, 0x41, 0x306,
+    0x303, 0x61, 0x306, 0x303, 0x41, 0x323, 0x306, 0x61, 0x323, 0x306,
+    0x45, 0x323, 0x65, 0x323, 0x45, 0x309, 0x65, 0x309, 0x45, 0x303,
+    0x65, 0x303, 0x45, 0x302, 0x301, 0x65, 0x302, 0x301, 0x45, 0x302,
+    0x300, 0x65, 0x302, 0x300, 0x45, 0x302, 0x309, 0x65, 0x302, 0x309,
+    0x45, 0x302, 0x303, 0x65, 0x302, 0x303, 0x45, 0x323, 0x302, 0x65,
+    0x323, 0x302, 0x49, 0x309, 0x69, 0x309, 0x49, 0x323, 0x69, 0x323,
+    0x4f, 0x323, 0x6f, 0x323, 0x4f, 0x309, 0x6f, 0x309, 0x4f, 0x302,
+    0x301, 0x6f, 0x302, 0x301, 0x4f, 0x302, 0x300, 0x6f, 0x302, 0x300,
+    0x4f, 0x302, 0x309, 0x6f, 0x302, 0x309, 0x4f, 0x302, 0x303, 0x6f,
+    0x302, 0x303, 0x4f, 0x323, 0x302, 0x6f, 0x323, 0x302, 0x4f, 0x31b,
+    0x301, 0x6f, 0x31b, 0x301, 0x4f, 0x31b, 0x300, 0x6f, 0x31b, 0x300,
+    0x4f, 0x31b, 0x309, 0x6f, 0x31b, 0x309, 0x4f, 0x31b, 0x303, 0x6f,
+    0x31b, 0x303, 0x4f, 0x31b, 0x323, 0x6f, 0x31b, 0x323, 0x55, 0x323,
+    0x75, 0x323, 0x55, 0x309, 0x75, 0x309, 0x55, 0x31b, 0x301, 0x75,
+    0x31b, 0x301, 0x55, 0x31b, 0x300, 0x75, 0x31b, 0x300, 0x55, 0x31b,
+    0x309, 0x75, 0x31b, 0x309, 0x55, 0x31b, 0x303, 0x75, 0x31b, 0x303,
+    0x55, 0x31b, 0x323, 0x75, 0x31b, 0x323, 0x59, 0x300, 0x79, 0x300,
+    0x59, 0x323, 0x79, 0x323, 0x59, 0x309, 0x79, 0x309, 0x59, 0x303,
+    0x79, 0x303, 0x3b1, 0x313, 0x3b1, 0x314, 0x3b1, 0x313, 0x300, 0x3b1,
+    0x314, 0x300, 0x3b1, 0x313, 0x301, 0x3b1, 0x314, 0x301, 0x3b1, 0x313,
+    0x342, 0x3b1, 0x314, 0x342, 0x391, 0x313, 0x391, 0x314, 0x391, 0x313,
+    0x300, 0x391, 0x314, 0x300, 0x391, 0x313, 0x301, 0x391, 0x314, 0x301,
+    0x391, 0x313, 0x342, 0x391, 0x314, 0x342, 0x3b5, 0x313, 0x3b5, 0x314,
+    0x3b5, 0x313, 0x300, 0x3b5, 0x314, 0x300, 0x3b5, 0x313, 0x301, 0x3b5,
+    0x314, 0x301, 0x395, 0x313, 0x395, 0x314, 0x395, 0x313, 0x300, 0x395,
+    0x314, 0x300, 0x395, 0x313, 0x301, 0x395, 0x314, 0x301, 0x3b7, 0x313,
+    0x3b7, 0x314, 0x3b7, 0x313, 0x300, 0x3b7, 0x314, 0x300, 0x3b7, 0x313,
+    0x301, 0x3b7, 0x314, 0x301, 0x3b7, 0x313, 0x342, 0x3b7, 0x314, 0x342,
+    0x397, 0x313, 0x397, 0x314, 0x397, 0x313, 0x300, 0x397, 0x314, 0x300,
+    0x397, 0x313, 0x301, 0x397, 0x314, 0x301, 0x397, 0x313, 0x342, 0x397,
+    0x314, 0x342, 0x3b9, 0x313, 0x3b9, 0x314, 0x3b9, 0x313, 0x300, 0x3b9,
+    0x314, 0x300, 0x3b9, 0x313, 0x301, 0x3b9, 0x314, 0x301, 0x3b9, 0x313,
+    0x342, 0x3b9, 0x314, 0x342, 0x399, 0x313, 0x399, 0x314, 0x399, 0x313,
+    0x300, 0x399, 0x314, 0x300, 0x399, 0x313, 0x301, 0x399, 0x314, 0x301,
+    0x399, 0x313, 0x342, 0x399, 0x314, 0x342, 0x3bf, 0x313, 0x3bf, 0x314,
+    0x3bf, 0x313, 0x300, 0x3bf, 0x314, 0x300, 0x3bf, 0x313, 0x301, 0x3bf,
+    0x314, 0x301, 0x39f, 0x313, 0x39f, 0x314, 0x39f, 0x313, 0x300, 0x39f,
+    0x314, 0x300, 0x39f, 0x313, 0x301, 0x39f, 0x314, 0x301, 0x3c5, 0x313,
+    0x3c5, 0x314, 0x3c5, 0x313, 0x300, 0x3c5, 0x314, 0x300, 0x3c5, 0x313,
+    0x301, 0x3c5, 0x314, 0x301, 0x3c5, 0x313, 0x342, 0x3c5, 0x314, 0x342,
+    0x3a5, 0x314, 0x3a5, 0x314, 0x300, 0x3a5, 0x314, 0x301, 0x3a5, 0x314,
+    0x342, 0x3c9, 0x313, 0x3c9, 0x314, 0x3c9, 0x313, 0x300, 0x3c9, 0x314,
+    0x300, 0x3c9, 0x313, 0x301, 0x3c9, 0x314, 0x301, 0x3c9, 0x313, 0x342,
+    0x3c9, 0x314, 0x342, 0x3a9, 0x313, 0x3a9, 0x314, 0x3a9, 0x313, 0x300,
+    0x3a9, 0x314, 0x300, 0x3a9, 0x313, 0x301, 0x3a9, 0x314, 0x301, 0x3a9,
+    0x313, 0x342, 0x3a9, 0x314, 0x342, 0x3b1, 0x300, 0x3b1, 0x301, 0x3b5,
+    0x300, 0x3b5, 0x301, 0x3b7, 0x300, 0x3b7, 0x301, 0x3b9, 0x300, 0x3b9,
+    0x301, 0x3bf, 0x300, 0x3bf, 0x301, 0x3c5, 0x300, 0x3c5, 0x301, 0x3c9,
+    0x300, 0x3c9, 0x301, 0x3b1, 0x313, 0x345, 0x3b1, 0x314, 0x345, 0x3b1,
+    0x313, 0x300, 0x345, 0x3b1, 0x314, 0x300, 0x345, 0x3b1, 0x313, 0x301,
+    0x345, 0x3b1, 0x314, 0x301, 0x345, 0x3b1, 0x313, 0x342, 0x345, 0x3b1,
+    0x314, 0x342, 0x345, 0x391, 0x313, 0x345, 0x391, 0x314, 0x345, 0x391,
+    0x313, 0x300, 0x345, 0x391, 0x314, 0x300, 0x345, 0x391, 0x313, 0x301,
+    0x345, 0x391, 0x314, 0x301, 0x345, 0x391, 0x313, 0x342, 0x345, 0x391,
+    0x314, 0x342, 0x345, 0x3b7, 0x313, 0x345, 0x3b7, 0x314, 0x345, 0x3b7,
+    0x313, 0x300, 0x345, 0x3b7, 0x314, 0x300, 0x345, 0x3b7, 0x313, 0x301,
+    0x345, 0x3b7, 0x314, 0x301, 0x345, 0x3b7, 0x313, 0x342, 0x345, 0x3b7,
+    0x314, 0x342, 0x345, 0x397, 0x313, 0x345, 0x397, 0x314, 0x345, 0x397,
+    0x313, 0x300, 0x345, 0x397, 0x314, 0x300, 0x345, 0x397, 0x313, 0x301,
+    0x345, 0x397, 0x314, 0x301, 0x345, 0x397, 0x313, 0x342, 0x345, 0x397,
+    0x314, 0x342, 0x345, 0x3c9, 0x313, 0x345, 0x3c9, 0x314, 0x345, 0x3c9,
+    0x313, 0x300, 0x345, 0x3c9, 0x314, 0x300, 0x345, 0x3c9, 0x313, 0x301,
+    0x345, 0x3c9, 0x314, 0x301, 0x345, 0x3c9, 0x313, 0x342, 0x345, 0x3c9,
+    0x314, 0x342, 0x345, 0x3a9, 0x313, 0x345, 0x3a9, 0x314, 0x345, 0x3a9,
+    0x313, 0x300, 0x345, 0x3a9, 0x314, 0x300, 0x345, 0x3a9, 0x313, 0x301,
+    0x345, 0x3a9, 0x314, 0x301, 0x345, 0x3a9, 0x313, 0x342, 0x345, 0x3a9,
+    0x314, 0x342, 0x345, 0x3b1, 0x306, 0x3b1, 0x304, 0x3b1, 0x300, 0x345,
+    0x3b1, 0x345, 0x3b1, 0x301, 0x345, 0x3b1, 0x342, 0x3b1, 0x342, 0x345,
+    0x391, 0x306, 0x391, 0x304, 0x391, 0x300, 0x391, 0x301, 0x391, 0x345,
+    0x3b9, 0xa8, 0x342, 0x3b7, 0x300, 0x345, 0x3b7, 0x345, 0x3b7, 0x301,
+    0x345, 0x3b7, 0x342, 0x3b7, 0x342, 0x345, 0x395, 0x300, 0x395, 0x301,
+    0x397, 0x300, 0x397, 0x301, 0x397, 0x345, 0x1fbf, 0x300, 0x1fbf, 0x301,
+    0x1fbf, 0x342, 0x3b9, 0x306, 0x3b9, 0x304, 0x3b9, 0x308, 0x300, 0x3b9,
+    0x308, 0x301, 0x3b9, 0x342, 0x3b9, 0x308, 0x342, 0x399, 0x306, 0x399,
+    0x304, 0x399, 0x300, 0x399, 0x301, 0x1ffe, 0x300, 0x1ffe, 0x301, 0x1ffe,
+    0x342, 0x3c5, 0x306, 0x3c5, 0x304, 0x3c5, 0x308, 0x300, 0x3c5, 0x308,
+    0x301, 0x3c1, 0x313, 0x3c1, 0x314, 0x3c5, 0x342, 0x3c5, 0x308, 0x342,
+    0x3a5, 0x306, 0x3a5, 0x304, 0x3a5, 0x300, 0x3a5, 0x301, 0x3a1, 0x314,
+    0xa8, 0x300, 0xa8, 0x301, 0x60, 0x3c9, 0x300, 0x345, 0x3c9, 0x345,
+    0x3c9, 0x301, 0x345, 0x3c9, 0x342, 0x3c9, 0x342, 0x345, 0x39f, 0x300,
+    0x39f, 0x301, 0x3a9, 0x300, 0x3a9, 0x301, 0x3a9, 0x345, 0xb4, 0x2002,
+    0x2003, 0x3a9, 0x4b, 0x41, 0x30a, 0x2190, 0x338, 0x2192, 0x338, 0x2194,
+    0x338, 0x21d0, 0x338, 0x21d4, 0x338, 0x21d2, 0x338, 0x2203, 0x338, 0x2208,
+    0x338, 0x220b, 0x338, 0x2223, 0x338, 0x2225, 0x338, 0x223c, 0x338, 0x2243,
+    0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3d, 0x338, 0x2261, 0x338, 0x224d,
+    0x338, 0x3c, 0x338, 0x3e, 0x338, 0x2264, 0x338, 0x2265, 0x338, 0x2272,
+    0x338, 0x2273, 0x338, 0x2276, 0x338, 0x2277, 0x338, 0x227a, 0x338, 0x227b,
+    0x338, 0x2282, 0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287, 0x338, 0x22a2,
+    0x338, 0x22a8, 0x338, 0x22a9, 0x338, 0x22ab, 0x338, 0x227c, 0x338, 0x227d,
+    0x338, 0x2291, 0x338, 0x2292, 0x338, 0x22b2, 0x338, 0x22b3, 0x338, 0x22b4,
+    0x338, 0x22b5, 0x338, 0x3008, 0x3009, 0x2add, 0x338, 0x304b, 0x3099, 0x304d,
+    0x3099, 0x304f, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057,
+    0x3099, 0x3059, 0x3099, 0x305b, 0x3099, 0x305d, 0x3099, 0x305f, 0x3099, 0x3061,
+    0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f,
+    0x309a, 0x3072, 0x3099, 0x3072, 0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078,
+    0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b, 0x309a, 0x3046, 0x3099, 0x309d,
+    0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1, 0x3099, 0x30b3,
+    0x3099, 0x30b5, 0x3099, 0x30b7, 0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd,
+    0x3099, 0x30bf, 0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8,
+    0x3099, 0x30cf, 0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2, 0x309a, 0x30d5,
+    0x3099, 0x30d5, 0x309a, 0x30d8, 0x3099, 0x30d8, 0x309a, 0x30db, 0x3099, 0x30db,
+    0x309a, 0x30a6, 0x3099, 0x30ef, 0x3099, 0x30f0, 0x3099, 0x30f1, 0x3099, 0x30f2,
+    0x3099, 0x30fd, 0x3099, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+    0x9f9c, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f,
+    0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1,
+    0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964,
+    0x62c9, 0x81d8, 0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7,
+    0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c, 0x8def, 0x9732,
+    0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304, 0x9e7f, 0x8ad6, 0x58df,
+    0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13,
+    0x6dda, 0x6f0f, 0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c,
+    0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7, 0x6012,
+    0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc, 0x6578, 0x7d22,
+    0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5,
+    0x63a0, 0x7565, 0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+    0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97,
+    0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190, 0x6200, 0x649a, 0x6f23,
+    0x7149, 0x7489, 0x79ca, 0x7df4, 0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217,
+    0x52a3, 0x54bd, 0x70c8, 0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e,
+    0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046,
+    0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8, 0x60e1, 0x4e86,
+    0x50da, 0x5bee, 0x5c3f, 0x6599, 0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d,
+    0x6688, 0x962e, 0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b,
+    0x7d10, 0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b,
+    0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f, 0x5c65, 0x6613, 0x674e, 0x68a8,
+    0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba,
+    0x541d, 0x71d0, 0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+    0x7acb, 0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207,
+    0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c, 0x964d, 0x898b,
+    0x5ed3, 0x5140, 0x55c0, 0x585a, 0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e,
+    0x7965, 0x798f, 0x9756, 0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef,
+    0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4,
+    0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e, 0x6094, 0x6168,
+    0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e,
+    0x722b, 0x7422, 0x7891, 0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d,
+    0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed,
+    0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08, 0x8fb6,
+    0x9038, 0x96e3, 0x97ff, 0x983b, 0x6075, 0x242ee, 0x8218, 0x4e26, 0x51b5, 0x5168,
+    0x4f80, 0x5145, 0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a,
+    0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8,
+    0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c, 0x6452, 0x6556,
+    0x6674, 0x6717, 0x671b, 0x6756, 0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22,
+    0x701e, 0x716e, 0x77a7, 0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d,
+    0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b,
+    0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941, 0x8986, 0x8996,
+    0x8abf, 0x8af8, 0x8acb, 0x8b01, 0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38,
+    0x9072, 0x9199, 0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b,
+    0x9b12, 0x9f9c, 0x2284a, 0x22844, 0x233d5, 0x3b9d, 0x4018, 0x4039, 0x25249, 0x25cd0,
+    0x27ed3, 0x9f43, 0x9f8e, 0x5d9, 0x5b4, 0x5f2, 0x5b7, 0x5e9, 0x5c1, 0x5e9,
+    0x5c2, 0x5e9, 0x5bc, 0x5c1, 0x5e9, 0x5bc, 0x5c2, 0x5d0, 0x5b7, 0x5d0,
+    0x5b8, 0x5d0, 0x5bc, 0x5d1, 0x5bc, 0x5d2, 0x5bc, 0x5d3, 0x5bc, 0x5d4,
+    0x5bc, 0x5d5, 0x5bc, 0x5d6, 0x5bc, 0x5d8, 0x5bc, 0x5d9, 0x5bc, 0x5da,
+    0x5bc, 0x5db, 0x5bc, 0x5dc, 0x5bc, 0x5de, 0x5bc, 0x5e0, 0x5bc, 0x5e1,
+    0x5bc, 0x5e3, 0x5bc, 0x5e4, 0x5bc, 0x5e6, 0x5bc, 0x5e7, 0x5bc, 0x5e8,
+    0x5bc, 0x5e9, 0x5bc, 0x5ea, 0x5bc, 0x5d5, 0x5b9, 0x5d1, 0x5bf, 0x5db,
+    0x5bf, 0x5e4, 0x5bf, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5, 0x110ba, 0x11131,
+    0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347, 0x11357, 0x114b9, 0x114ba, 0x114b9,
+    0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af, 0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157,
+    0x1d165, 0x1d158, 0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158,
+    0x1d165, 0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9, 0x1d165,
+    0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba, 0x1d165, 0x1d16e, 0x1d1b9, 0x1d165,
+    0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f, 0x4e3d, 0x4e38, 0x4e41, 0x20122, 0x4f60, 0x4fae,
+    0x4fbb, 0x5002, 0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e, 0x2063a, 0x514d, 0x5154,
+    0x5164, 0x5177, 0x2051c, 0x34b9, 0x5167, 0x518d, 0x2054b, 0x5197, 0x51a4, 0x4ecc,
+    0x51ac, 0x51b5, 0x291df, 0x51f5, 0x5203, 0x34df, 0x523b, 0x5246, 0x5272, 0x5277,
+    0x3515, 0x52c7, 0x52c9, 0x52e4, 0x52fa, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351,
+    0x535a, 0x5373, 0x537d, 0x537f, 0x537f, 0x537f, 0x20a2c, 0x7070, 0x53ca, 0x53df,
+    0x20b63, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6,
+    0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab, 0x55b3, 0x55c2, 0x5716,
+    0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b,
+    0x5832, 0x5831, 0x58ac, 0x214e4, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962,
+    0x216a8, 0x216ea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08,
+    0x5b3e, 0x5b3e, 0x219c8, 0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0x21b18, 0x5bff, 0x5c06,
+    0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5c6e, 0x5cc0, 0x5c8d, 0x21de4, 0x5d43, 0x21de6,
+    0x5d6e, 0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69,
+    0x3862, 0x22183, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0x2a392, 0x5efe, 0x22331,
+    0x22331, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0x232b8, 0x261da, 0x5f62, 0x5f6b, 0x38e3,
+    0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a, 0x391c, 0x6094, 0x226d4, 0x60c7,
+    0x6148, 0x614c, 0x614e, 0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de,
+    0x61f2, 0x61f6, 0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0x22b0c, 0x633d,
+    0x62fc, 0x6368, 0x6383, 0x63e4, 0x22bf1, 0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469,
+    0x647e, 0x649d, 0x6477, 0x3a6c, 0x654f, 0x656c, 0x2300a, 0x65e3, 0x66f8, 0x6649,
+    0x3b19, 0x6691, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9,
+    0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0x233c3, 0x3b49, 0x67fa, 0x6785, 0x6852,
+    0x6885, 0x2346d, 0x688e, 0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3, 0x69ea, 0x6aa8,
+    0x236a3, 0x6adb, 0x3c18, 0x6b21, 0x238a7, 0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bba,
+    0x6bbb, 0x23a8d, 0x21d0b, 0x23afa, 0x6c4e, 0x23cbc, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16,
+    0x6d3e, 0x6d77, 0x6d41, 0x6d69, 0x6d78, 0x6d85, 0x23d1e, 0x6d34, 0x6e2f, 0x6e6e,
+    0x3d33, 0x6ecb, 0x6ec7, 0x23ed1, 0x6df9, 0x6f6e, 0x23f5e, 0x23f8e, 0x6fc6, 0x7039,
+    0x701e, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad, 0x20525, 0x7145, 0x24263,
+    0x719c, 0x243ab, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+    0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447, 0x745c, 0x7471, 0x7485,
+    0x74ca, 0x3f1b, 0x7524, 0x24c36, 0x753e, 0x24c92, 0x7570, 0x2219f, 0x7610, 0x24fa1,
+    0x24fb8, 0x25044, 0x3ffc, 0x4008, 0x76f4, 0x250f3, 0x250f2, 0x25119, 0x25133, 0x771e,
+    0x771f, 0x771f, 0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0x2541d, 0x784e, 0x788c,
+    0x78cc, 0x40e3, 0x25626, 0x7956, 0x2569a, 0x256c5, 0x798f, 0x79eb, 0x412f, 0x7a40,
+    0x7a4a, 0x7a4f, 0x2597c, 0x25aa7, 0x25aa7, 0x7aee, 0x4202, 0x25bab, 0x7bc6, 0x7bc9,
+    0x4227, 0x25c80, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0x25f86, 0x7d63, 0x4301,
+    0x7dc7, 0x7e02, 0x7e45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262d9, 0x7f7a, 0x2633e,
+    0x7f95, 0x7ffa, 0x8005, 0x264da, 0x26523, 0x8060, 0x265a8, 0x8070, 0x2335f, 0x43d5,
+    0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0x267a7, 0x267b5, 0x23393, 0x2339c, 0x8201,
+    0x8204, 0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd,
+    0x82e6, 0x26b3c, 0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8457,
+    0x8353, 0x83ca, 0x83cc, 0x83dc, 0x26c36, 0x26d6b, 0x26cd5, 0x452b, 0x84f1, 0x84f3,
+    0x8516, 0x273ca, 0x8564, 0x26f2c, 0x455d, 0x4561, 0x26fb1, 0x270d2, 0x456b, 0x8650,
+    0x865c, 0x8667, 0x8669, 0x86a9, 0x8688, 0x870e, 0x86e2, 0x8779, 0x8728, 0x876b,
+    0x8786, 0x45d7, 0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0x27667, 0x88d7, 0x88de,
+    0x4635, 0x88fa, 0x34bb, 0x278ae, 0x27966, 0x46be, 0x46c7, 0x8aa0, 0x8aed, 0x8b8a,
+    0x8c55, 0x27ca8, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0x27f2f, 0x20804, 0x8dcb, 0x8dbc,
+    0x8df0, 0x208de, 0x8ed4, 0x8f38, 0x285d2, 0x285ed, 0x9094, 0x90f1, 0x9111, 0x2872e,
+    0x911b, 0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0x28bfa, 0x958b, 0x4995,
+    0x95b7, 0x28d77, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0x29145, 0x2921a, 0x4a6e, 0x4a76,
+    0x97e0, 0x2940a, 0x4ab2, 0x29496, 0x980b, 0x980b, 0x9829, 0x295b6, 0x98e2, 0x4b33,
+    0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce, 0x29b30, 0x9b12, 0x9c40, 0x9cfd, 0x4cce,
+    0x4ced, 0x9d67, 0x2a0ce, 0x4cf8, 0x2a105, 0x2a20e, 0x2a291, 0x9ebb, 0x4d56, 0x9ef9,
+    0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b, 0x2a600,
+};
+
+// Primary composites keyed by (first << 21 | second), sorted (Hangul excluded).
+struct composition_entry
+{
+    std::uint64_t pair;
+    std::uint32_t composite;
+};
+
+inline constexpr composition_entry compositions[941] = {
+    {0x7800338ull, 0x226e}, {0x7a00338ull, 0x2260}, {0x7c00338ull, 0x226f},
+    {0x8200300ull, 0xc0}, {0x8200301ull, 0xc1}, {0x8200302ull, 0xc2},
+    {0x8200303ull, 0xc3}, {0x8200304ull, 0x100}, {0x8200306ull, 0x102},
+    {0x8200307ull, 0x226}, {0x8200308ull, 0xc4}, {0x8200309ull, 0x1ea2},
+    {0x820030aull, 0xc5}, {0x820030cull, 0x1cd}, {0x820030full, 0x200},
+    {0x8200311ull, 0x202}, {0x8200323ull, 0x1ea0}, {0x8200325ull, 0x1e00},
+    {0x8200328ull, 0x104}, {0x8400307ull, 0x1e02}, {0x8400323ull, 0x1e04},
+    {0x8400331ull, 0x1e06}, {0x8600301ull, 0x106}, {0x8600302ull, 0x108},
+    {0x8600307ull, 0x10a}, {0x860030cull, 0x10c}, {0x8600327ull, 0xc7},
+    {0x8800307ull, 0x1e0a}, {0x880030cull, 0x10e}, {0x8800323ull, 0x1e0c},
+    {0x8800327ull, 0x1e10}, {0x880032dull, 0x1e12}, {0x8800331ull, 0x1e0e},
+    {0x8a00300ull, 0xc8}, {0x8a00301ull, 0xc9}, {0x8a00302ull, 0xca},
+    {0x8a00303ull, 0x1ebc}, {0x8a00304ull, 0x112}, {0x8a00306ull, 0x114},
+    {0x8a00307ull, 0x116}, {0x8a00308ull, 0xcb}, {0x8a00309ull, 0x1eba},
+    {0x8a0030cull, 0x11a}, {0x8a0030full, 0x204}, {0x8a00311ull, 0x206},
+    {0x8a00323ull, 0x1eb8}, {0x8a00327ull, 0x228}, {0x8a00328ull, 0x118},
+    {0x8a0032dull, 0x1e18}, {0x8a00330ull, 0x1e1a}, {0x8c00307ull, 0x1e1e},
+    {0x8e00301ull, 0x1f4}, {0x8e00302ull, 0x11c}, {0x8e00304ull, 0x1e20},
+    {0x8e00306ull, 0x11e}, {0x8e00307ull, 0x120}, {0x8e0030cull, 0x1e6},
+    {0x8e00327ull, 0x122}, {0x9000302ull, 0x124}, {0x9000307ull, 0x1e22},
+    {0x9000308ull, 0x1e26}, {0x900030cull, 0x21e}, {0x9000323ull, 0x1e24},
+    {0x9000327ull, 0x1e28}, {0x900032eull, 0x1e2a}, {0x9200300ull, 0xcc},
+    {0x9200301ull, 0xcd}, {0x9200302ull, 0xce}, {0x9200303ull, 0x128},
+    {0x9200304ull, 0x12a}, {0x9200306ull, 0x12c}, {0x9200307ull, 0x130},
+    {0x9200308ull, 0xcf}, {0x9200309ull, 0x1ec8}, {0x920030cull, 0x1cf},
+    {0x920030full, 0x208}, {0x9200311ull, 0x20a}, {0x9200323ull, 0x1eca},
+    {0x9200328ull, 0x12e}, {0x9200330ull, 0x1e2c}, {0x9400302ull, 0x134},
+    {0x9600301ull, 0x1e30}, {0x960030cull, 0x1e8}, {0x9600323ull, 0x1e32},
+    {0x9600327ull, 0x136}, {0x9600331ull, 0x1e34}, {0x9800301ull, 0x139},
+    {0x980030cull, 0x13d}, {0x9800323ull, 0x1e36}, {0x9800327ull, 0x13b},
+    {0x980032dull, 0x1e3c}, {0x9800331ull, 0x1e3a}, {0x9a00301ull, 0x1e3e},
+    {0x9a00307ull, 0x1e40}, {0x9a00323ull, 0x1e42}, {0x9c00300ull, 0x1f8},
+    {0x9c00301ull, 0x143}, {0x9c00303ull, 0xd1}, {0x9c00307ull, 0x1e44},
+    {0x9c0030cull, 0x147}, {0x9c00323ull, 0x1e46}, {0x9c00327ull, 0x145},
+    {0x9c0032dull, 0x1e4a}, {0x9c00331ull, 0x1e48}, {0x9e00300ull, 0xd2},
+    {0x9e00301ull, 0xd3}, {0x9e00302ull, 0xd4}, {0x9e00303ull, 0xd5},
+    {0x9e00304ull, 0x14c}, {0x9e00306ull, 0x14e}, {0x9e00307ull, 0x22e},
+    {0x9e00308ull, 0xd6}, {0x9e00309ull, 0x1ece}, {0x9e0030bull, 0x150},
+    {0x9e0030cull, 0x1d1}, {0x9e0030full, 0x20c}, {0x9e00311ull, 0x20e},
+    {0x9e0031bull, 0x1a0}, {0x9e00323ull, 0x1ecc}, {0x9e00328ull, 0x1ea},
+    {0xa000301ull, 0x1e54}, {0xa000307ull, 0x1e56}, {0xa400301ull, 0x154},
+    {0xa400307ull, 0x1e58}, {0xa40030cull, 0x158}, {0xa40030full, 0x210},
+    {0xa400311ull, 0x212}, {0xa400323ull, 0x1e5a}, {0xa400327ull, 0x156},
+    {0xa400331ull, 0x1e5e}, {0xa600301ull, 0x15a}, {0xa600302ull, 0x15c},
+    {0xa600307ull, 0x1e60}, {0xa60030cull, 0x160}, {0xa600323ull, 0x1e62},
+    {0xa600326ull, 0x218}, {0xa600327ull, 0x15e}, {0xa800307ull, 0x1e6a},
+    {0xa80030cull, 0x164}, {0xa800323ull, 0x1e6c}, {0xa800326ull, 0x21a},
+    {0xa800327ull, 0x162}, {0xa80032dull, 0x1e70}, {0xa800331ull, 0x1e6e},
+    {0xaa00300ull, 0xd9}, {0xaa00301ull, 0xda}, {0xaa00302ull, 0xdb},
+    {0xaa00303ull, 0x168}, {0xaa00304ull, 0x16a}, {0xaa00306ull, 0x16c},
+    {0xaa00308ull, 0xdc}, {0xaa00309ull, 0x1ee6}, {0xaa0030aull, 0x16e},
+    {0xaa0030bull, 0x170}, {0xaa0030cull, 0x1d3}, {0xaa0030full, 0x214},
+    {0xaa00311ull, 0x216}, {0xaa0031bull, 0x1af}, {0xaa00323ull, 0x1ee4},
+    {0xaa00324ull, 0x1e72}, {0xaa00328ull, 0x172}, {0xaa0032dull, 0x1e76},
+    {0xaa00330ull, 0x1e74}, {0xac00303ull, 0x1e7c}, {0xac00323ull, 0x1e7e},
+    {0xae00300ull, 0x1e80}, {0xae00301ull, 0x1e82}, {0xae00302ull, 0x174},
+    {0xae00307ull, 0x1e86}, {0xae00308ull, 0x1e84}, {0xae00323ull, 0x1e88},
+    {0xb000307ull, 0x1e8a}, {0xb000308ull, 0x1e8c}, {0xb200300ull, 0x1ef2},
+    {0xb200301ull, 0xdd}, {0xb200302ull, 0x176}, {0xb200303ull, 0x1ef8},
+    {0xb200304ull, 0x232}, {0xb200307ull, 0x1e8e}, {0xb200308ull, 0x178},
+    {0xb200309ull, 0x1ef6}, {0xb200323ull, 0x1ef4}, {0xb400301ull, 0x179},
+    {0xb400302ull, 0x1e90}, {0xb400307ull, 0x17b}, {0xb40030cull, 0x17d},
+    {0xb400323ull, 0x1e92}, {0xb400331ull, 0x1e94}, {0xc200300ull, 0xe0},
+    {0xc200301ull, 0xe1}, {0xc200302ull, 0xe2}, {0xc200303ull, 0xe3},
+    {0xc200304ull, 0x101}, {0xc200306ull, 0x103}, {0xc200307ull, 0x227},
+    {0xc200308ull, 0xe4}, {0xc200309ull, 0x1ea3}, {0xc20030aull, 0xe5},
+    {0xc20030cull, 0x1ce}, {0xc20030full, 0x201}, {0xc200311ull, 0x203},
+    {0xc200323ull, 0x1ea1}, {0xc200325ull, 0x1e01}, {0xc200328ull, 0x105},
+    {0xc400307ull, 0x1e03}, {0xc400323ull, 0x1e05}, {0xc400331ull, 0x1e07},
+    {0xc600301ull, 0x107}, {0xc600302ull, 0x109}, {0xc600307ull, 0x10b},
+    {0xc60030cull, 0x10d}, {0xc600327ull, 0xe7}, {0xc800307ull, 0x1e0b},
+    {0xc80030cull, 0x10f}, {0xc800323ull, 0x1e0d}, {0xc800327ull, 0x1e11},
+    {0xc80032dull, 0x1e13}, {0xc800331ull, 0x1e0f}, {0xca00300ull, 0xe8},
+    {0xca00301ull, 0xe9}, {0xca00302ull, 0xea}, {0xca00303ull, 0x1ebd},
+    {0xca00304ull, 0x113}, {0xca00306ull, 0x115}, {0xca00307ull, 0x117},
+    {0xca00308ull, 0xeb}, {0xca00309ull, 0x1ebb}, {0xca0030cull, 0x11b},
+    {0xca0030full, 0x205}, {0xca00311ull, 0x207}, {0xca00323ull, 0x1eb9},
+    {0xca00327ull, 0x229}, {0xca00328ull, 0x119}, {0xca0032dull, 0x1e19},
+    {0xca00330ull, 0x1e1b}, {0xcc00307ull, 0x1e1f}, {0xce00301ull, 0x1f5},
+    {0xce00302ull, 0x11d}, {0xce00304ull, 0x1e21}, {0xce00306ull, 0x11f},
+    {0xce00307ull, 0x121}, {0xce0030cull, 0x1e7}, {0xce00327ull, 0x123},
+    {0xd000302ull, 0x125}, {0xd000307ull, 0x1e23}, {0xd000308ull, 0x1e27},
+    {0xd00030cull, 0x21f}, {0xd000323ull, 0x1e25}, {0xd000327ull, 0x1e29},
+    {0xd00032eull, 0x1e2b}, {0xd000331ull, 0x1e96}, {0xd200300ull, 0xec},
+    {0xd200301ull, 0xed}, {0xd200302ull, 0xee}, {0xd200303ull, 0x129},
+    {0xd200304ull, 0x12b}, {0xd200306ull, 0x12d}, {0xd200308ull, 0xef},
+    {0xd200309ull, 0x1ec9}, {0xd20030cull, 0x1d0}, {0xd20030full, 0x209},
+    {0xd200311ull, 0x20b}, {0xd200323ull, 0x1ecb}, {0xd200328ull, 0x12f},
+    {0xd200330ull, 0x1e2d}, {0xd400302ull, 0x135}, {0xd40030cull, 0x1f0},
+    {0xd600301ull, 0x1e31}, {0xd60030cull, 0x1e9}, {0xd600323ull, 0x1e33},
+    {0xd600327ull, 0x137}, {0xd600331ull, 0x1e35}, {0xd800301ull, 0x13a},
+    {0xd80030cull, 0x13e}, {0xd800323ull, 0x1e37}, {0xd800327ull, 0x13c},
+    {0xd80032dull, 0x1e3d}, {0xd800331ull, 0x1e3b}, {0xda00301ull, 0x1e3f},
+    {0xda00307ull, 0x1e41}, {0xda00323ull, 0x1e43}, {0xdc00300ull, 0x1f9},
+    {0xdc00301ull, 0x144}, {0xdc00303ull, 0xf1}, {0xdc00307ull, 0x1e45},
+    {0xdc0030cull, 0x148}, {0xdc00323ull, 0x1e47}, {0xdc00327ull, 0x146},
+    {0xdc0032dull, 0x1e4b}, {0xdc00331ull, 0x1e49}, {0xde00300ull, 0xf2},
+    {0xde00301ull, 0xf3}, {0xde00302ull, 0xf4}, {0xde00303ull, 0xf5},
+    {0xde00304ull, 0x14d}, {0xde00306ull, 0x14f}, {0xde00307ull, 0x22f},
+    {0xde00308ull, 0xf6}, {0xde00309ull, 0x1ecf}, {0xde0030bull, 0x151},
+    {0xde0030cull, 0x1d2}, {0xde0030full, 0x20d}, {0xde00311ull, 0x20f},
+    {0xde0031bull, 0x1a1}, {0xde00323ull, 0x1ecd}, {0xde00328ull, 0x1eb},
+    {0xe000301ull, 0x1e55}, {0xe000307ull, 0x1e57}, {0xe400301ull, 0x155},
+    {0xe400307ull, 0x1e59}, {0xe40030cull, 0x159}, {0xe40030full, 0x211},
+    {0xe400311ull, 0x213}, {0xe400323ull, 0x1e5b}, {0xe400327ull, 0x157},
+    {0xe400331ull, 0x1e5f}, {0xe600301ull, 0x15b}, {0xe600302ull, 0x15d},
+    {0xe600307ull, 0x1e61}, {0xe60030cull, 0x161}, {0xe600323ull, 0x1e63},
+    {0xe600326ull, 0x219}, {0xe600327ull, 0x15f}, {0xe800307ull, 0x1e6b},
+    {0xe800308ull, 0x1e97}, {0xe80030cull, 0x165}, {0xe800323ull, 0x1e6d},
+    {0xe800326ull, 0x21b}, {0xe800327ull, 0x163}, {0xe80032dull, 0x1e71},
+    {0xe800331ull, 0x1e6f}, {0xea00300ull, 0xf9}, {0xea00301ull, 0xfa},
+    {0xea00302ull, 0xfb}, {0xea00303ull, 0x169}, {0xea00304ull, 0x16b},
+    {0xea00306ull, 0x16d}, {0xea00308ull, 0xfc}, {0xea00309ull, 0x1ee7},
+    {0xea0030aull, 0x16f}, {0xea0030bull, 0x171}, {0xea0030cull, 0x1d4},
+    {0xea0030full, 0x215}, {0xea00311ull, 0x217}, {0xea0031bull, 0x1b0},
+    {0xea00323ull, 0x1ee5}, {0xea00324ull, 0x1e73}, {0xea00328ull, 0x173},
+    {0xea0032dull, 0x1e77}, {0xea00330ull, 0x1e75}, {0xec00303ull, 0x1e7d},
+    {0xec00323ull, 0x1e7f}, {0xee00300ull, 0x1e81}, {0xee00301ull, 0x1e83},
+    {0xee00302ull, 0x175}, {0xee00307ull, 0x1e87}, {0xee00308ull, 0x1e85},
+    {0xee0030aull, 0x1e98}, {0xee00323ull, 0x1e89}, {0xf000307ull, 0x1e8b},
+    {0xf000308ull, 0x1e8d}, {0xf200300ull, 0x1ef3}, {0xf200301ull, 0xfd},
+    {0xf200302ull, 0x177}, {0xf200303ull, 0x1ef9}, {0xf200304ull, 0x233},
+    {0xf200307ull, 0x1e8f}, {0xf200308ull, 0xff}, {0xf200309ull, 0x1ef7},
+    {0xf20030aull, 0x1e99}, {0xf200323ull, 0x1ef5}, {0xf400301ull, 0x17a},
+    {0xf400302ull, 0x1e91}, {0xf400307ull, 0x17c}, {0xf40030cull, 0x17e},
+    {0xf400323ull, 0x1e93}, {0xf400331ull, 0x1e95}, {0x15000300ull, 0x1fed},
+    {0x15000301ull, 0x385}, {0x15000342ull, 0x1fc1}, {0x18400300ull, 0x1ea6},
+    {0x18400301ull, 0x1ea4}, {0x18400303ull, 0x1eaa}, {0x18400309ull, 0x1ea8},
+    {0x18800304ull, 0x1de}, {0x18a00301ull, 0x1fa}, {0x18c00301ull, 0x1fc},
+    {0x18c00304ull, 0x1e2}, {0x18e00301ull, 0x1e08}, {0x19400300ull, 0x1ec0},
+    {0x19400301ull, 0x1ebe}, {0x19400303ull, 0x1ec4}, {0x19400309ull, 0x1ec2},
+    {0x19e00301ull, 0x1e2e}, {0x1a800300ull, 0x1ed2}, {0x1a800301ull, 0x1ed0},
+    {0x1a800303ull, 0x1ed6}, {0x1a800309ull, 0x1ed4}, {0x1aa00301ull, 0x1e4c},
+    {0x1aa00304ull, 0x22c}, {0x1aa00308ull, 0x1e4e}, {0x1ac00304ull, 0x22a},
+    {0x1b000301ull, 0x1fe}, {0x1b800300ull, 0x1db}, {0x1b800301ull, 0x1d7},
+    {0x1b800304ull, 0x1d5}, {0x1b80030cull, 0x1d9}, {0x1c400300ull, 0x1ea7},
+    {0x1c400301ull, 0x1ea5}, {0x1c400303ull, 0x1eab}, {0x1c400309ull, 0x1ea9},
+    {0x1c800304ull, 0x1df}, {0x1ca00301ull, 0x1fb}, {0x1cc00301ull, 0x1fd},
+    {0x1cc00304ull, 0x1e3}, {0x1ce00301ull, 0x1e09}, {0x1d400300ull, 0x1ec1},
+    {0x1d400301ull, 0x1ebf}, {0x1d400303ull, 0x1ec5}, {0x1d400309ull, 0x1ec3},
+    {0x1de00301ull, 0x1e2f}, {0x1e800300ull, 0x1ed3}, {0x1e800301ull, 0x1ed1},
+    {0x1e800303ull, 0x1ed7}, {0x1e800309ull, 0x1ed5}, {0x1ea00301ull, 0x1e4d},
+    {0x1ea00304ull, 0x22d}, {0x1ea00308ull, 0x1e4f}, {0x1ec00304ull, 0x22b},
+    {0x1f000301ull, 0x1ff}, {0x1f800300ull, 0x1dc}, {0x1f800301ull, 0x1d8},
+    {0x1f800304ull, 0x1d6}, {0x1f80030cull, 0x1da}, {0x20400300ull, 0x1eb0},
+    {0x20400301ull, 0x1eae}, {0x20400303ull, 0x1eb4}, {0x20400309ull, 0x1eb2},
+    {0x20600300ull, 0x1eb1}, {0x20600301ull, 0x1eaf}, {0x20600303ull, 0x1eb5},
+    {0x20600309ull, 0x1eb3}, {0x22400300ull, 0x1e14}, {0x22400301ull, 0x1e16},
+    {0x22600300ull, 0x1e15}, {0x22600301ull, 0x1e17}, {0x29800300ull, 0x1e50},
+    {0x29800301ull, 0x1e52}, {0x29a00300ull, 0x1e51}, {0x29a00301ull, 0x1e53},
+    {0x2b400307ull, 0x1e64}, {0x2b600307ull, 0x1e65}, {0x2c000307ull, 0x1e66},
+    {0x2c200307ull, 0x1e67}, {0x2d000301ull, 0x1e78}, {0x2d200301ull, 0x1e79},
+    {0x2d400308ull, 0x1e7a}, {0x2d600308ull, 0x1e7b}, {0x2fe00307ull, 0x1e9b},
+    {0x34000300ull, 0x1edc}, {0x34000301ull, 0x1eda}, {0x34000303ull, 0x1ee0},
+    {0x34000309ull, 0x1ede}, {0x34000323ull, 0x1ee2}, {0x34200300ull, 0x1edd},
+    {0x34200301ull, 0x1edb}, {0x34200303ull, 0x1ee1}, {0x34200309ull, 0x1edf},
+    {0x34200323ull, 0x1ee3}, {0x35e00300ull, 0x1eea}, {0x35e00301ull, 0x1ee8},
+    {0x35e00303ull, 0x1eee}, {0x35e00309ull, 0x1eec}, {0x35e00323ull, 0x1ef0},
+    {0x36000300ull, 0x1eeb}, {0x36000301ull, 0x1ee9}, {0x36000303ull, 0x1eef},
+    {0x36000309ull, 0x1eed}, {0x36000323ull, 0x1ef1}, {0x36e0030cull, 0x1ee},
+    {0x3d400304ull, 0x1ec}, {0x3d600304ull, 0x1ed}, {0x44c00304ull, 0x1e0},
+    {0x44e00304ull, 0x1e1}, {0x45000306ull, 0x1e1c}, {0x45200306ull, 0x1e1d},
+    {0x45c00304ull, 0x230}, {0x45e00304ull, 0x231}, {0x5240030cull, 0x1ef},
+    {0x72200300ull, 0x1fba}, {0x72200301ull, 0x386}, {0x72200304ull, 0x1fb9},
+    {0x72200306ull, 0x1fb8}, {0x72200313ull, 0x1f08}, {0x72200314ull, 0x1f09},
+    {0x72200345ull, 0x1fbc}, {0x72a00300ull, 0x1fc8}, {0x72a00301ull, 0x388},
+    {0x72a00313ull, 0x1f18}, {0x72a00314ull, 0x1f19}, {0x72e00300ull, 0x1fca},
+    {0x72e00301ull, 0x389}, {0x72e00313ull, 0x1f28}, {0x72e00314ull, 0x1f29},
+    {0x72e00345ull, 0x1fcc}, {0x73200300ull, 0x1fda}, {0x73200301ull, 0x38a},
+    {0x73200304ull, 0x1fd9}, {0x73200306ull, 0x1fd8}, {0x73200308ull, 0x3aa},
+    {0x73200313ull, 0x1f38}, {0x73200314ull, 0x1f39}, {0x73e00300ull, 0x1ff8},
+    {0x73e00301ull, 0x38c}, {0x73e00313ull, 0x1f48}, {0x73e00314ull, 0x1f49},
+    {0x74200314ull, 0x1fec}, {0x74a00300ull, 0x1fea}, {0x74a00301ull, 0x38e},
+    {0x74a00304ull, 0x1fe9}, {0x74a00306ull, 0x1fe8}, {0x74a00308ull, 0x3ab},
+    {0x74a00314ull, 0x1f59}, {0x75200300ull, 0x1ffa}, {0x75200301ull, 0x38f},
+    {0x75200313ull, 0x1f68}, {0x75200314ull, 0x1f69}, {0x75200345ull, 0x1ffc},
+    {0x75800345ull, 0x1fb4}, {0x75c00345ull, 0x1fc4}, {0x76200300ull, 0x1f70},
+    {0x76200301ull, 0x3ac}, {0x76200304ull, 0x1fb1}, {0x76200306ull, 0x1fb0},
+    {0x76200313ull, 0x1f00}, {0x76200314ull, 0x1f01}, {0x76200342ull, 0x1fb6},
+    {0x76200345ull, 0x1fb3}, {0x76a00300ull, 0x1f72}, {0x76a00301ull, 0x3ad},
+    {0x76a00313ull, 0x1f10}, {0x76a00314ull, 0x1f11}, {0x76e00300ull, 0x1f74},
+    {0x76e00301ull, 0x3ae}, {0x76e00313ull, 0x1f20}, {0x76e00314ull, 0x1f21},
+    {0x76e00342ull, 0x1fc6}, {0x76e00345ull, 0x1fc3}, {0x77200300ull, 0x1f76},
+    {0x77200301ull, 0x3af}, {0x77200304ull, 0x1fd1}, {0x77200306ull, 0x1fd0},
+    {0x77200308ull, 0x3ca}, {0x77200313ull, 0x1f30}, {0x77200314ull, 0x1f31},
+    {0x77200342ull, 0x1fd6}, {0x77e00300ull, 0x1f78}, {0x77e00301ull, 0x3cc},
+    {0x77e00313ull, 0x1f40}, {0x77e00314ull, 0x1f41}, {0x78200313ull, 0x1fe4},
+    {0x78200314ull, 0x1fe5}, {0x78a00300ull, 0x1f7a}, {0x78a00301ull, 0x3cd},
+    {0x78a00304ull, 0x1fe1}, {0x78a00306ull, 0x1fe0}, {0x78a00308ull, 0x3cb},
+    {0x78a00313ull, 0x1f50}, {0x78a00314ull, 0x1f51}, {0x78a00342ull, 0x1fe6},
+    {0x79200300ull, 0x1f7c}, {0x79200301ull, 0x3ce}, {0x79200313ull, 0x1f60},
+    {0x79200314ull, 0x1f61}, {0x79200342ull, 0x1ff6}, {0x79200345ull, 0x1ff3},
+    {0x79400300ull, 0x1fd2}, {0x79400301ull, 0x390}, {0x79400342ull, 0x1fd7},
+    {0x79600300ull, 0x1fe2}, {0x79600301ull, 0x3b0}, {0x79600342ull, 0x1fe7},
+    {0x79c00345ull, 0x1ff4}, {0x7a400301ull, 0x3d3}, {0x7a400308ull, 0x3d4},
+    {0x80c00308ull, 0x407}, {0x82000306ull, 0x4d0}, {0x82000308ull, 0x4d2},
+    {0x82600301ull, 0x403}, {0x82a00300ull, 0x400}, {0x82a00306ull, 0x4d6},
+    {0x82a00308ull, 0x401}, {0x82c00306ull, 0x4c1}, {0x82c00308ull, 0x4dc},
+    {0x82e00308ull, 0x4de}, {0x83000300ull, 0x40d}, {0x83000304ull, 0x4e2},
+    {0x83000306ull, 0x419}, {0x83000308ull, 0x4e4}, {0x83400301ull, 0x40c},
+    {0x83c00308ull, 0x4e6}, {0x84600304ull, 0x4ee}, {0x84600306ull, 0x40e},
+    {0x84600308ull, 0x4f0}, {0x8460030bull, 0x4f2}, {0x84e00308ull, 0x4f4},
+    {0x85600308ull, 0x4f8}, {0x85a00308ull, 0x4ec}, {0x86000306ull, 0x4d1},
+    {0x86000308ull, 0x4d3}, {0x86600301ull, 0x453}, {0x86a00300ull, 0x450},
+    {0x86a00306ull, 0x4d7}, {0x86a00308ull, 0x451}, {0x86c00306ull, 0x4c2},
+    {0x86c00308ull, 0x4dd}, {0x86e00308ull, 0x4df}, {0x87000300ull, 0x45d},
+    {0x87000304ull, 0x4e3}, {0x87000306ull, 0x439}, {0x87000308ull, 0x4e5},
+    {0x87400301ull, 0x45c}, {0x87c00308ull, 0x4e7}, {0x88600304ull, 0x4ef},
+    {0x88600306ull, 0x45e}, {0x88600308ull, 0x4f1}, {0x8860030bull, 0x4f3},
+    {0x88e00308ull, 0x4f5}, {0x89600308ull, 0x4f9}, {0x89a00308ull, 0x4ed},
+    {0x8ac00308ull, 0x457}, {0x8e80030full, 0x476}, {0x8ea0030full, 0x477},
+    {0x9b000308ull, 0x4da}, {0x9b200308ull, 0x4db}, {0x9d000308ull, 0x4ea},
+    {0x9d200308ull, 0x4eb}, {0xc4e00653ull, 0x622}, {0xc4e00654ull, 0x623},
+    {0xc4e00655ull, 0x625}, {0xc9000654ull, 0x624}, {0xc9400654ull, 0x626},
+    {0xd8200654ull, 0x6c2}, {0xda400654ull, 0x6d3}, {0xdaa00654ull, 0x6c0},
+    {0x12500093cull, 0x929}, {0x12600093cull, 0x931}, {0x12660093cull, 0x934},
+    {0x138e009beull, 0x9cb}, {0x138e009d7ull, 0x9cc}, {0x168e00b3eull, 0xb4b},
+    {0x168e00b56ull, 0xb48}, {0x168e00b57ull, 0xb4c}, {0x172400bd7ull, 0xb94},
+    {0x178c00bbeull, 0xbca}, {0x178c00bd7ull, 0xbcc}, {0x178e00bbeull, 0xbcb},
+    {0x188c00c56ull, 0xc48}, {0x197e00cd5ull, 0xcc0}, {0x198c00cc2ull, 0xcca},
+    {0x198c00cd5ull, 0xcc7}, {0x198c00cd6ull, 0xcc8}, {0x199400cd5ull, 0xccb},
+    {0x1a8c00d3eull, 0xd4a}, {0x1a8c00d57ull, 0xd4c}, {0x1a8e00d3eull, 0xd4b},
+    {0x1bb200dcaull, 0xdda}, {0x1bb200dcfull, 0xddc}, {0x1bb200ddfull, 0xdde},
+    {0x1bb800dcaull, 0xddd}, {0x204a0102eull, 0x1026}, {0x360a01b35ull, 0x1b06},
+    {0x360e01b35ull, 0x1b08}, {0x361201b35ull, 0x1b0a}, {0x361601b35ull, 0x1b0c},
+    {0x361a01b35ull, 0x1b0e}, {0x362201b35ull, 0x1b12}, {0x367401b35ull, 0x1b3b},
+    {0x367801b35ull, 0x1b3d}, {0x367c01b35ull, 0x1b40}, {0x367e01b35ull, 0x1b41},
+    {0x368401b35ull, 0x1b43}, {0x3c6c00304ull, 0x1e38}, {0x3c6e00304ull, 0x1e39},
+    {0x3cb400304ull, 0x1e5c}, {0x3cb600304ull, 0x1e5d}, {0x3cc400307ull, 0x1e68},
+    {0x3cc600307ull, 0x1e69}, {0x3d4000302ull, 0x1eac}, {0x3d4000306ull, 0x1eb6},
+    {0x3d4200302ull, 0x1ead}, {0x3d4200306ull, 0x1eb7}, {0x3d7000302ull, 0x1ec6},
+    {0x3d7200302ull, 0x1ec7}, {0x3d9800302ull, 0x1ed8}, {0x3d9a00302ull, 0x1ed9},
+    {0x3e0000300ull, 0x1f02}, {0x3e0000301ull, 0x1f04}, {0x3e0000342ull, 0x1f06},
+    {0x3e0000345ull, 0x1f80}, {0x3e0200300ull, 0x1f03}, {0x3e0200301ull, 0x1f05},
+    {0x3e0200342ull, 0x1f07}, {0x3e0200345ull, 0x1f81}, {0x3e0400345ull, 0x1f82},
+    {0x3e0600345ull, 0x1f83}, {0x3e0800345ull, 0x1f84}, {0x3e0a00345ull, 0x1f85},
+    {0x3e0c00345ull, 0x1f86}, {0x3e0e00345ull, 0x1f87}, {0x3e1000300ull, 0x1f0a},
+    {0x3e1000301ull, 0x1f0c}, {0x3e1000342ull, 0x1f0e}, {0x3e1000345ull, 0x1f88},
+    {0x3e1200300ull, 0x1f0b}, {0x3e1200301ull, 0x1f0d}, {0x3e1200342ull, 0x1f0f},
+    {0x3e1200345ull, 0x1f89}, {0x3e1400345ull, 0x1f8a}, {0x3e1600345ull, 0x1f8b},
+    {0x3e1800345ull, 0x1f8c}, {0x3e1a00345ull, 0x1f8d}, {0x3e1c00345ull, 0x1f8e},
+    {0x3e1e00345ull, 0x1f8f}, {0x3e2000300ull, 0x1f12}, {0x3e2000301ull, 0x1f14},
+    {0x3e2200300ull, 0x1f13}, {0x3e2200301ull, 0x1f15}, {0x3e3000300ull, 0x1f1a},
+    {0x3e3000301ull, 0x1f1c}, {0x3e3200300ull, 0x1f1b}, {0x3e3200301ull, 0x1f1d},
+    {0x3e4000300ull, 0x1f22}, {0x3e4000301ull, 0x1f24}, {0x3e4000342ull, 0x1f26},
+    {0x3e4000345ull, 0x1f90}, {0x3e4200300ull, 0x1f23}, {0x3e4200301ull, 0x1f25},
+    {0x3e4200342ull, 0x1f27}, {0x3e4200345ull, 0x1f91}, {0x3e4400345ull, 0x1f92},
+    {0x3e4600345ull, 0x1f93}, {0x3e4800345ull, 0x1f94}, {0x3e4a00345ull, 0x1f95},
+    {0x3e4c00345ull, 0x1f96}, {0x3e4e00345ull, 0x1f97}, {0x3e5000300ull, 0x1f2a},
+    {0x3e5000301ull, 0x1f2c}, {0x3e5000342ull, 0x1f2e}, {0x3e5000345ull, 0x1f98},
+    {0x3e5200300ull, 0x1f2b}, {0x3e5200301ull, 0x1f2d}, {0x3e5200342ull, 0x1f2f},
+    {0x3e5200345ull, 0x1f99}, {0x3e5400345ull, 0x1f9a}, {0x3e5600345ull, 0x1f9b},
+    {0x3e5800345ull, 0x1f9c}, {0x3e5a00345ull, 0x1f9d}, {0x3e5c00345ull, 0x1f9e},
+    {0x3e5e00345ull, 0x1f9f}, {0x3e6000300ull, 0x1f32}, {0x3e6000301ull, 0x1f34},
+    {0x3e6000342ull, 0x1f36}, {0x3e6200300ull, 0x1f33}, {0x3e6200301ull, 0x1f35},
+    {0x3e6200342ull, 0x1f37}, {0x3e7000300ull, 0x1f3a}, {0x3e7000301ull, 0x1f3c},
+    {0x3e7000342ull, 0x1f3e}, {0x3e7200300ull, 0x1f3b}, {0x3e7200301ull, 0x1f3d},
+    {0x3e7200342ull, 0x1f3f}, {0x3e8000300ull, 0x1f42}, {0x3e8000301ull, 0x1f44},
+    {0x3e8200300ull, 0x1f43}, {0x3e8200301ull, 0x1f45}, {0x3e9000300ull, 0x1f4a},
+    {0x3e9000301ull, 0x1f4c}, {0x3e9200300ull, 0x1f4b}, {0x3e9200301ull, 0x1f4d},
+    {0x3ea000300ull, 0x1f52}, {0x3ea000301ull, 0x1f54}, {0x3ea000342ull, 0x1f56},
+    {0x3ea200300ull, 0x1f53}, {0x3ea200301ull, 0x1f55}, {0x3ea200342ull, 0x1f57},
+    {0x3eb200300ull, 0x1f5b}, {0x3eb200301ull, 0x1f5d}, {0x3eb200342ull, 0x1f5f},
+    {0x3ec000300ull, 0x1f62}, {0x3ec000301ull, 0x1f64}, {0x3ec000342ull, 0x1f66},
+    {0x3ec000345ull, 0x1fa0}, {0x3ec200300ull, 0x1f63}, {0x3ec200301ull, 0x1f65},
+    {0x3ec200342ull, 0x1f67}, {0x3ec200345ull, 0x1fa1}, {0x3ec400345ull, 0x1fa2},
+    {0x3ec600345ull, 0x1fa3}, {0x3ec800345ull, 0x1fa4}, {0x3eca00345ull, 0x1fa5},
+    {0x3ecc00345ull, 0x1fa6}, {0x3ece00345ull, 0x1fa7}, {0x3ed000300ull, 0x1f6a},
+    {0x3ed000301ull, 0x1f6c}, {0x3ed000342ull, 0x1f6e}, {0x3ed000345ull, 0x1fa8},
+    {0x3ed200300ull, 0x1f6b}, {0x3ed200301ull, 0x1f6d}, {0x3ed200342ull, 0x1f6f},
+    {0x3ed200345ull, 0x1fa9}, {0x3ed400345ull, 0x1faa}, {0x3ed600345ull, 0x1fab},
+    {0x3ed800345ull, 0x1fac}, {0x3eda00345ull, 0x1fad}, {0x3edc00345ull, 0x1fae},
+    {0x3ede00345ull, 0x1faf}, {0x3ee000345ull, 0x1fb2}, {0x3ee800345ull, 0x1fc2},
+    {0x3ef800345ull, 0x1ff2}, {0x3f6c00345ull, 0x1fb7}, {0x3f7e00300ull, 0x1fcd},
+    {0x3f7e00301ull, 0x1fce}, {0x3f7e00342ull, 0x1fcf}, {0x3f8c00345ull, 0x1fc7},
+    {0x3fec00345ull, 0x1ff7}, {0x3ffc00300ull, 0x1fdd}, {0x3ffc00301ull, 0x1fde},
+    {0x3ffc00342ull, 0x1fdf}, {0x432000338ull, 0x219a}, {0x432400338ull, 0x219b},
+    {0x432800338ull, 0x21ae}, {0x43a000338ull, 0x21cd}, {0x43a400338ull, 0x21cf},
+    {0x43a800338ull, 0x21ce}, {0x440600338ull, 0x2204}, {0x441000338ull, 0x2209},
+    {0x441600338ull, 0x220c}, {0x444600338ull, 0x2224}, {0x444a00338ull, 0x2226},
+    {0x447800338ull, 0x2241}, {0x448600338ull, 0x2244}, {0x448a00338ull, 0x2247},
+    {0x449000338ull, 0x2249}, {0x449a00338ull, 0x226d}, {0x44c200338ull, 0x2262},
+    {0x44c800338ull, 0x2270}, {0x44ca00338ull, 0x2271}, {0x44e400338ull, 0x2274},
+    {0x44e600338ull, 0x2275}, {0x44ec00338ull, 0x2278}, {0x44ee00338ull, 0x2279},
+    {0x44f400338ull, 0x2280}, {0x44f600338ull, 0x2281}, {0x44f800338ull, 0x22e0},
+    {0x44fa00338ull, 0x22e1}, {0x450400338ull, 0x2284}, {0x450600338ull, 0x2285},
+    {0x450c00338ull, 0x2288}, {0x450e00338ull, 0x2289}, {0x452200338ull, 0x22e2},
+    {0x452400338ull, 0x22e3}, {0x454400338ull, 0x22ac}, {0x455000338ull, 0x22ad},
+    {0x455200338ull, 0x22ae}, {0x455600338ull, 0x22af}, {0x456400338ull, 0x22ea},
+    {0x456600338ull, 0x22eb}, {0x456800338ull, 0x22ec}, {0x456a00338ull, 0x22ed},
+    {0x608c03099ull, 0x3094}, {0x609603099ull, 0x304c}, {0x609a03099ull, 0x304e},
+    {0x609e03099ull, 0x3050}, {0x60a203099ull, 0x3052}, {0x60a603099ull, 0x3054},
+    {0x60aa03099ull, 0x3056}, {0x60ae03099ull, 0x3058}, {0x60b203099ull, 0x305a},
+    {0x60b603099ull, 0x305c}, {0x60ba03099ull, 0x305e}, {0x60be03099ull, 0x3060},
+    {0x60c203099ull, 0x3062}, {0x60c803099ull, 0x3065}, {0x60cc03099ull, 0x3067},
+    {0x60d003099ull, 0x3069}, {0x60de03099ull, 0x3070}, {0x60de0309aull, 0x3071},
+    {0x60e403099ull, 0x3073}, {0x60e40309aull, 0x3074}, {0x60ea03099ull, 0x3076},
+    {0x60ea0309aull, 0x3077}, {0x60f003099ull, 0x3079}, {0x60f00309aull, 0x307a},
+    {0x60f603099ull, 0x307c}, {0x60f60309aull, 0x307d}, {0x613a03099ull, 0x309e},
+    {0x614c03099ull, 0x30f4}, {0x615603099ull, 0x30ac}, {0x615a03099ull, 0x30ae},
+    {0x615e03099ull, 0x30b0}, {0x616203099ull, 0x30b2}, {0x616603099ull, 0x30b4},
+    {0x616a03099ull, 0x30b6}, {0x616e03099ull, 0x30b8}, {0x617203099ull, 0x30ba},
+    {0x617603099ull, 0x30bc}, {0x617a03099ull, 0x30be}, {0x617e03099ull, 0x30c0},
+    {0x618203099ull, 0x30c2}, {0x618803099ull, 0x30c5}, {0x618c03099ull, 0x30c7},
+    {0x619003099ull, 0x30c9}, {0x619e03099ull, 0x30d0}, {0x619e0309aull, 0x30d1},
+    {0x61a403099ull, 0x30d3}, {0x61a40309aull, 0x30d4}, {0x61aa03099ull, 0x30d6},
+    {0x61aa0309aull, 0x30d7}, {0x61b003099ull, 0x30d9}, {0x61b00309aull, 0x30da},
+    {0x61b603099ull, 0x30dc}, {0x61b60309aull, 0x30dd}, {0x61de03099ull, 0x30f7},
+    {0x61e003099ull, 0x30f8}, {0x61e203099ull, 0x30f9}, {0x61e403099ull, 0x30fa},
+    {0x61fa03099ull, 0x30fe}, {0x22132110baull, 0x1109a}, {0x22136110baull, 0x1109c},
+    {0x2214a110baull, 0x110ab}, {0x2226211127ull, 0x1112e}, {0x2226411127ull, 0x1112f},
+    {0x2268e1133eull, 0x1134b}, {0x2268e11357ull, 0x1134c}, {0x22972114b0ull, 0x114bc},
+    {0x22972114baull, 0x114bb}, {0x22972114bdull, 0x114be}, {0x22b70115afull, 0x115ba},
+    {0x22b72115afull, 0x115bb}, {0x2326a11930ull, 0x11938},
+};
+
+} // namespace unicode
+} // namespace detail
+} // namespace cinter
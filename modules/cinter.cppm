@@ -0,0 +1,69 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Named module exporting the core of cinter, i.e. what cinter.hpp provides.
+// Build this interface unit once per configuration, then `import cinter;`
+// instead of including cinter.hpp.  With GCC, for example:
+//
+//     g++ -std=c++20 -fmodules-ts -Iinclude -c -x c++ modules/cinter.cppm
+//
+// Define CINTER_LEAN_HEADERS the same way for the module and its importers.
+module;
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#ifndef CINTER_LEAN_HEADERS
+#include <functional>
+#include <string>
+#endif
+export module cinter;
+
+#define CINTER_EXPORT export
+#include "cinter.hpp"
+
+// GCC 12 does not make the partial specializations of
+// std::ranges::enable_borrowed_range in safe_string.hpp visible to
+// importers; full specializations for the aliases are.
+#ifdef __cpp_lib_ranges
+namespace std::ranges
+{
+template <> inline constexpr bool enable_borrowed_range<cinter::safe_string> = true;
+template <> inline constexpr bool enable_borrowed_range<cinter::safe_wstring> = true;
+#ifdef __cpp_char8_t
+template <> inline constexpr bool enable_borrowed_range<cinter::safe_u8string> = true;
+#endif
+template <> inline constexpr bool enable_borrowed_range<cinter::safe_u16string> = true;
+template <> inline constexpr bool enable_borrowed_range<cinter::safe_u32string> = true;
+template <> inline constexpr bool enable_borrowed_range<cinter::sized_safe_string> = true;
+template <> inline constexpr bool enable_borrowed_range<cinter::sized_safe_wstring> = true;
+} // namespace std::ranges
+#endif
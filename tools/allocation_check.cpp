@@ -0,0 +1,276 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+// Checks how many heap allocations each cinter operation makes.  Each
+// operation is run with a counting operator new and its allocation count is
+// compared with the exact number it is expected to make: hot paths must not
+// allocate at all, and the operations that return or grow an owning object
+// must not allocate more than they do today.  The program exits non-zero if
+// any count differs, so it can gate a build (tools/check.sh runs it):
+//
+//     g++ -std=c++17 -O2 -Iinclude tools/allocation_check.cpp -lsqlite3 -o allocation_check && ./allocation_check
+//
+// Every line of output is a JSON object as written by
+// write_allocation_report(); mismatches are also described on stderr.  The
+// expected counts are those of libstdc++ (15 character small strings).
+
+#include "allocation_counter.hpp"
+#include "bloom_filter.hpp"
+#include "clock_cache.hpp"
+#include "codec.hpp"
+#include "compressed_dictionary.hpp"
+#include "concurrent_string_map.hpp"
+#include "demangle.hpp"
+#include "glob_set.hpp"
+#include "hash.hpp"
+#include "linux_records.hpp"
+#include "natural_compare.hpp"
+#include "normalization.hpp"
+#include "packed_safe_string.hpp"
+#include "path.hpp"
+#include "radix_tree.hpp"
+#include "realpath_cache.hpp"
+#include "safe_string.hpp"
+#include "sqlite.hpp"
+#include "string_table.hpp"
+#include "string_table_snapshot.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+CINTER_DEFINE_COUNTING_OPERATOR_NEW()
+
+namespace
+{
+
+bool passed = true;
+
+// Runs fn once to warm up lazily built state, then checks that a second run
+// makes exactly expected allocations.
+template <typename Fn>
+void check(const char* operation, std::size_t expected, Fn&& fn)
+{
+    fn();
+    const cinter::allocation_stats stats = cinter::measure_allocations(fn);
+    cinter::write_allocation_report(stdout, operation, stats);
+    if (stats.allocations != expected)
+    {
+        std::fprintf(stderr, "%s: expected %zu allocations, made %zu\n", operation, expected, stats.allocations);
+        passed = false;
+    }
+}
+
+// Keeps results alive so the measured calls are not optimized away.
+volatile std::size_t sink;
+
+} // namespace
+
+int main()
+{
+    const char* const key   = "/usr/lib/x86_64-linux-gnu/libstdc++.so.6";
+    const char* const other = "/usr/lib/x86_64-linux-gnu/libstdc++.so.7";
+    const char* const small = "libc.so.6";
+
+    // Views, comparisons and hashing.
+    check("safe_string::view", 0, [&] { sink = cinter::safe_string(key).view().size(); });
+    check("safe_string::sized", 0, [&] { sink = cinter::safe_string(key).sized().size(); });
+    check("safe_string::as", 0, [&] { sink = cinter::safe_string(key).as<unsigned char>().view().size(); });
+    check("bounded_safe_string::view", 0, [&] { sink = cinter::bounded_safe_string(key, 16).view().size(); });
+    check("safe_string::operator<", 0, [&] { sink = cinter::safe_string(key) < cinter::safe_string(other); });
+    check("hash_with_length", 0, [&] { sink = cinter::hash_with_length(cinter::safe_string(key)).hash; });
+    check("packed_safe_string::operator==", 0, [&] {
+        const cinter::packed_safe_string a(key);
+        const cinter::packed_safe_string b(other);
+        sink = a == b;
+    });
+    check("compare_natural", 0, [&] { sink = static_cast<std::size_t>(cinter::compare_natural(cinter::safe_string(key), cinter::safe_string(other))); });
+
+    // Conversions to owning strings allocate unless the small string buffer holds them.
+    check("safe_string::string (small)", 0, [&] { sink = cinter::safe_string(small).string().size(); });
+    check("safe_string::string", 1, [&] { sink = cinter::safe_string(key).string().size(); });
+
+    // Containers.
+    cinter::string_table table;
+    table.intern(key);
+    check("string_table::find", 0, [&] { sink = table.find(key).value() + table.find(other).value(); });
+    check("string_table::intern (existing)", 0, [&] { sink = table.intern(key); });
+    // The slots, the entries, the chunk list and the first chunk.
+    check("string_table::intern (new table)", 4, [&] {
+        cinter::string_table fresh;
+        sink = fresh.intern(key);
+    });
+
+    cinter::radix_tree<int> tree;
+    tree.insert_or_assign(key, 1);
+    check("radix_tree::find", 0, [&] { sink = tree.find(key).is_ok() + tree.longest_prefix_match(other).is_ok(); });
+
+    cinter::concurrent_string_map<int> map;
+    map.try_emplace(key, 1);
+    check("concurrent_string_map::find", 0, [&] { sink = map.find(key).is_ok() + map.find(other).is_ok(); });
+
+    cinter::clock_cache<int> cache;
+    cache.insert(key, 1);
+    check("clock_cache::find", 0, [&] { sink = cache.find(key).has_value() + cache.find(other).has_value(); });
+
+    const cinter::safe_string patterns[] = {"*.so", "*.so.[0-9]", "/usr/lib/*", "lib?tdc++*"};
+    const cinter::glob_set globs(patterns, sizeof(patterns) / sizeof(patterns[0]));
+    check("glob_set::matches_any", 0, [&] { sink = globs.matches_any(key) + globs.matches_any(other); });
+
+    cinter::blocked_bloom_filter bloom(patterns, sizeof(patterns) / sizeof(patterns[0]));
+    check("blocked_bloom_filter::insert", 0, [&] { bloom.insert(key); });
+    check("blocked_bloom_filter::may_contain", 0, [&] { sink = bloom.may_contain(key) + bloom.may_contain(other); });
+
+    const cinter::safe_string words[] = {key, other, small, "/usr/lib/x86_64-linux-gnu/libm.so.6"};
+    const cinter::compressed_dictionary dictionary(words, sizeof(words) / sizeof(words[0]));
+    check("compressed_dictionary::equals", 0, [&] { sink = dictionary.equals(0, key) + dictionary.equals(1, key); });
+    check("compressed_dictionary::extract", 0, [&] {
+        char out[128];
+        sink = dictionary.extract(0, out, sizeof(out));
+    });
+    check("compressed_dictionary::string", 1, [&] { sink = dictionary.string(0).size(); });
+
+    char snapshot_path[] = "/tmp/cinter_allocation_check_XXXXXX";
+    const int snapshot_fd = ::mkstemp(snapshot_path);
+    if (snapshot_fd < 0 || save_snapshot(table, snapshot_path).has_error())
+    {
+        std::fprintf(stderr, "cannot write a snapshot to %s\n", snapshot_path);
+        return EXIT_FAILURE;
+    }
+    ::close(snapshot_fd);
+    cinter::string_table_snapshot snapshot;
+    check("string_table_snapshot::open", 0, [&] {
+        sink = static_cast<std::size_t>(snapshot.open(snapshot_path, cinter::snapshot_verify::checksum).value());
+    });
+    if (!snapshot.is_open())
+    {
+        std::fprintf(stderr, "cannot open the snapshot %s\n", snapshot_path);
+        return EXIT_FAILURE;
+    }
+    check("string_table_snapshot::find", 0, [&] { sink = snapshot.find(key).value() + snapshot.find(other).value(); });
+    snapshot.close();
+    ::unlink(snapshot_path);
+
+    // Two inotify events, the second with a padded name.
+    alignas(inotify_event) unsigned char events[2 * sizeof(inotify_event) + 16] = {};
+    inotify_event first{};
+    inotify_event second{};
+    second.len = 16;
+    std::memcpy(events, &first, sizeof(first));
+    std::memcpy(events + sizeof(first), &second, sizeof(second));
+    std::memcpy(events + 2 * sizeof(first), "name", 4);
+    check("inotify_event_range", 0, [&] {
+        for (const inotify_event& e : cinter::inotify_event_range(events, sizeof(events)))
+        {
+            sink = cinter::event_name(e).view().size();
+        }
+    });
+
+    cinter::sqlite_database db;
+    if (db.open(":memory:").has_error())
+    {
+        std::fprintf(stderr, "cannot open an in-memory database\n");
+        return EXIT_FAILURE;
+    }
+    {
+        cinter::sqlite_statement_cache statements(db.handle());
+        check("sqlite_statement_cache::acquire", 0, [&] {
+            cinter::sqlite_statement_lease q;
+            sink = static_cast<std::size_t>(statements.acquire("SELECT 1", q).value());
+        });
+    }
+
+    cinter::realpath_cache paths;
+    check("realpath_cache::resolve", 0, [&] { sink = paths.resolve("/usr/lib").path.view().size(); });
+
+    // Formatting and parsing.
+    check("hex_encode", 0, [&] {
+        char out[128];
+        sink = static_cast<std::size_t>(cinter::hex_encode(key, out, sizeof(out)).value());
+    });
+    check("hex_decode", 0, [&] {
+        unsigned char out[64];
+        sink = static_cast<std::size_t>(cinter::hex_decode("2f7573722f6c6962", out, sizeof(out)).value());
+    });
+    check("base64_encode", 0, [&] {
+        char out[128];
+        sink = static_cast<std::size_t>(cinter::base64_encode(key, out, sizeof(out)).value());
+    });
+    check("base64_decode", 0, [&] {
+        unsigned char out[64];
+        sink = static_cast<std::size_t>(cinter::base64_decode("L3Vzci9saWIveDg2XzY0", out, sizeof(out)).value());
+    });
+    check("hex_encode (std::string)", 1, [&] {
+        std::string out;
+        sink = static_cast<std::size_t>(cinter::hex_encode(key, out).value());
+    });
+    check("base64_decode (std::string)", 1, [&] {
+        std::string out;
+        sink = static_cast<std::size_t>(cinter::base64_decode("L3Vzci9saWIveDg2XzY0LWxpbnV4LWdudQ==", out).value());
+    });
+
+    check("normalize", 0, [&] {
+        char out[128];
+        sink = static_cast<std::size_t>(cinter::normalize(cinter::safe_string(key), out, sizeof(out)).value());
+    });
+    // "cafe" with a combining acute accent composes, which takes the slow path.
+    check("normalize (composing)", 0, [&] {
+        char out[128];
+        sink = static_cast<std::size_t>(cinter::normalize(cinter::safe_string("cafe\xcc\x81"), out, sizeof(out)).value());
+    });
+    // A segment of more than 32 code points moves the segment buffer to the heap.
+    std::string marks = "a";
+    for (int i = 0; i < 40; ++i)
+    {
+        marks += "\xcc\x81";
+    }
+    check("normalize (long segment)", 2, [&] {
+        char out[128];
+        sink = static_cast<std::size_t>(cinter::normalize(cinter::safe_string(marks.c_str()), out, sizeof(out)).value());
+    });
+
+    check("path_basename", 0, [&] { sink = cinter::path_basename(key).size() + cinter::path_dirname(key).size(); });
+    check("path_components", 0, [&] {
+        for (std::string_view component : cinter::path_components(key))
+        {
+            sink = component.size();
+        }
+    });
+    check("path_normalize", 0, [&] {
+        char out[128];
+        sink = static_cast<std::size_t>(cinter::path_normalize("/usr/./lib/../lib//x", out, sizeof(out)).value());
+    });
+
+    cinter::demangler names;
+    check("demangler::demangle", 0, [&] { sink = names.demangle("_ZNSt6vectorIiSaIiEE9push_backERKi").status.value(); });
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
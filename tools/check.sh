@@ -0,0 +1,20 @@
+#!/bin/sh
+# Builds and runs the checks that should gate a change to cinter: the
+# allocation check, compiled as C++17 and C++20 with warnings as errors.
+# Exits non-zero on the first failure.  Run it from the repository root;
+# CXX selects the compiler (g++ by default).
+#
+#     tools/check.sh
+
+set -eu
+
+CXX=${CXX:-g++}
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+
+for std in c++17 c++20; do
+    echo "allocation_check ($std)"
+    "$CXX" -std=$std -O2 -Wall -Wextra -Wpedantic -Werror -Iinclude tools/allocation_check.cpp -lsqlite3 \
+        -o "$out/allocation_check"
+    "$out/allocation_check" > "$out/allocations.json"
+done
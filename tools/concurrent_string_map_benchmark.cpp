@@ -0,0 +1,182 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) 2025, Kevin Hall
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+// Measures how concurrent_string_map scales with the number of threads, on
+// the workload it was written for: many threads incrementing counters keyed
+// by C-string identifiers.  The baseline is one mutex around
+// std::unordered_map<std::string, std::uint64_t>.
+//
+//     g++ -std=c++17 -O2 -pthread -Iinclude tools/concurrent_string_map_benchmark.cpp -o concurrent_string_map_benchmark
+//     ./concurrent_string_map_benchmark [keys] [increments] [max_threads]
+//
+// The defaults are 100000 keys, 8000000 increments and 64 threads.  Thread
+// counts double from 1 up to max_threads; every run does the same total
+// work, so on a machine with enough cores the Mops/s column should grow
+// with the thread count.  Both maps start empty, and the counts are checked
+// after every run.
+
+#include "concurrent_string_map.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// A cheap generator, so that the benchmark does not measure std::mt19937.
+struct xorshift
+{
+    std::uint64_t state;
+
+    std::uint64_t operator()() noexcept
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+// Runs body(thread_index, increments) on thread_count threads that start
+// together, and returns the elapsed seconds.
+template <typename Body>
+double run_threads(unsigned thread_count, long increments, Body body)
+{
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool>     go{false};
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < thread_count; ++t)
+    {
+        const long share = increments / thread_count + (t < increments % thread_count ? 1 : 0);
+        threads.emplace_back([&, t, share] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            body(t, share);
+        });
+    }
+    while (ready.load() != thread_count)
+    {
+        std::this_thread::yield();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long     key_count   = argc > 1 ? std::atol(argv[1]) : 100000;
+    const long     increments  = argc > 2 ? std::atol(argv[2]) : 8000000;
+    const unsigned max_threads = argc > 3 ? static_cast<unsigned>(std::atol(argv[3])) : 64;
+    if (key_count <= 0 || increments <= 0 || max_threads == 0)
+    {
+        std::fprintf(stderr, "usage: %s [keys] [increments] [max_threads]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<std::string> keys;
+    keys.reserve(static_cast<std::size_t>(key_count));
+    for (long i = 0; i < key_count; ++i)
+    {
+        keys.push_back("sensor/" + std::to_string(i * 2654435761u % 1000003) + "/count");
+    }
+    const auto pick = [&](xorshift& random) -> const char* {
+        return keys[random() % keys.size()].c_str();
+    };
+
+    std::printf("%u hardware threads, %ld keys, %ld increments per run; Mops/s\n",
+                std::thread::hardware_concurrency(), key_count, increments);
+    std::printf("%8s %8s %8s %8s\n", "threads", "mutex", "sharded", "speedup");
+    int status = 0;
+    for (unsigned thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+    {
+        std::mutex                                   mutex;
+        std::unordered_map<std::string, std::uint64_t> locked;
+        const double locked_seconds = run_threads(thread_count, increments, [&](unsigned t, long share) {
+            xorshift random{0x9E3779B97F4A7C15u * (t + 1)};
+            for (long i = 0; i < share; ++i)
+            {
+                const char*                 key = pick(random);
+                std::lock_guard<std::mutex> lock(mutex);
+                ++locked[key];
+            }
+        });
+
+        cinter::concurrent_string_map<std::atomic<std::uint64_t>> sharded;
+        const double sharded_seconds = run_threads(thread_count, increments, [&](unsigned t, long share) {
+            xorshift random{0x9E3779B97F4A7C15u * (t + 1)};
+            for (long i = 0; i < share; ++i)
+            {
+                sharded.try_emplace(pick(random)).first->value.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        // Both maps saw the same keys, so their counts must agree.
+        std::uint64_t total = 0;
+        for (const auto& [key, count] : locked)
+        {
+            const auto found = sharded.find(key.c_str());
+            if (!found.is_ok() || found.value()->value.load() != count)
+            {
+                std::fprintf(stderr, "count mismatch for %s\n", key.c_str());
+                status = 1;
+                break;
+            }
+            total += count;
+        }
+        if (total != static_cast<std::uint64_t>(increments) || sharded.size() != locked.size())
+        {
+            std::fprintf(stderr, "lost increments with %u threads\n", thread_count);
+            status = 1;
+        }
+
+        const double locked_rate  = increments / locked_seconds / 1e6;
+        const double sharded_rate = increments / sharded_seconds / 1e6;
+        std::printf("%8u %8.1f %8.1f %7.1fx\n", thread_count, locked_rate, sharded_rate, sharded_rate / locked_rate);
+        std::fflush(stdout);
+    }
+    return status;
+}
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+# Generates include/unicode_tables.hpp from the Unicode Character Database
+# bundled with Python (unicodedata).  The Unicode version of the tables is
+# that of the Python used to run the script.
+#
+#     python3 tools/gen_unicode_tables.py > include/unicode_tables.hpp
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+BLOCK_BITS = 7
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+HANGUL_S_BASE, HANGUL_S_COUNT = 0xAC00, 11172
+
+
+def canonical_decomposition(cp):
+    d = unicodedata.decomposition(chr(cp))
+    if not d or d.startswith('<'):
+        return None
+    return [int(x, 16) for x in d.split()]
+
+
+def full_decomposition(cp):
+    d = canonical_decomposition(cp)
+    if d is None:
+        return [cp]
+    out = []
+    for c in d:
+        out.extend(full_decomposition(c))
+    return out
+
+
+def main():
+    ccc = [unicodedata.combining(chr(cp)) for cp in range(MAX_CODE_POINT + 1)]
+
+    decompositions = {}
+    compositions = {}
+    for cp in range(MAX_CODE_POINT + 1):
+        if HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT:
+            continue
+        d = canonical_decomposition(cp)
+        if d is None:
+            continue
+        decompositions[cp] = full_decomposition(cp)
+        # Primary composites: pairs that NFC recomposes.  This excludes
+        # singletons, non-starter decompositions and the composition
+        # exclusions, all of which NFC leaves decomposed.
+        if len(d) == 2 and unicodedata.normalize('NFC', ''.join(map(chr, d))) == chr(cp):
+            compositions[(d[0], d[1])] = cp
+
+    second = {s for (_, s) in compositions}
+    # Hangul vowels and trailing consonants combine algorithmically.
+    second.update(range(0x1161, 0x1176))
+    second.update(range(0x11A8, 0x11C3))
+
+    # Property bits: ccc in bits 0-7, then the quick check values.
+    NFC_NO, NFC_MAYBE, NFD_NO = 1 << 8, 1 << 9, 1 << 10
+    props = []
+    for cp in range(MAX_CODE_POINT + 1):
+        p = ccc[cp]
+        s = chr(cp)
+        if 0xD800 <= cp <= 0xDFFF:
+            props.append(p)
+            continue
+        if unicodedata.normalize('NFC', s) != s:
+            p |= NFC_NO
+        elif cp in second:
+            p |= NFC_MAYBE
+        if unicodedata.normalize('NFD', s) != s:
+            p |= NFD_NO
+        props.append(p)
+
+    values = sorted(set(props))
+    value_index = {v: i for i, v in enumerate(values)}
+    assert len(values) < 256
+
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for start in range(0, MAX_CODE_POINT + 1, BLOCK_SIZE):
+        block = tuple(value_index[p] for p in props[start:start + BLOCK_SIZE])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+    assert len(blocks) < 65536
+
+    pool = []
+    decomposition_entries = []
+    for cp in sorted(decompositions):
+        d = decompositions[cp]
+        decomposition_entries.append((cp, len(pool), len(d)))
+        pool.extend(d)
+    assert max(len(d) for d in decompositions.values()) <= 4
+    assert len(pool) < 65536
+
+    w = sys.stdout.write
+    w('// Generated by tools/gen_unicode_tables.py from Unicode %s.  Do not edit.\n' % unicodedata.unidata_version)
+    w('#pragma once\n#include <cstdint>\n\nnamespace cinter\n{\nnamespace detail\n{\nnamespace unicode\n{\n\n')
+    w('inline constexpr char version[] = "%s";\n\n' % unicodedata.unidata_version)
+    w('inline constexpr unsigned block_bits = %d;\n\n' % BLOCK_BITS)
+    w('// Property bits: canonical combining class in bits 0-7.\n')
+    w('inline constexpr std::uint16_t nfc_no    = 0x%x;\n' % NFC_NO)
+    w('inline constexpr std::uint16_t nfc_maybe = 0x%x;\n' % NFC_MAYBE)
+    w('inline constexpr std::uint16_t nfd_no    = 0x%x;\n\n' % NFD_NO)
+
+    def array(ctype, name, items, per_line):
+        w('inline constexpr %s %s[%d] = {\n' % (ctype, name, len(items)))
+        for i in range(0, len(items), per_line):
+            w('    ' + ', '.join(items[i:i + per_line]) + ',\n')
+        w('};\n\n')
+
+    array('std::uint16_t', 'property_values', ['0x%x' % v for v in values], 12)
+    stage1_type = 'std::uint8_t' if len(blocks) < 256 else 'std::uint16_t'
+    array(stage1_type, 'property_stage1', [str(b) for b in stage1], 24)
+    array('std::uint8_t', 'property_stage2', [str(v) for b in blocks for v in b], 32)
+
+    w('struct decomposition_entry\n{\n    std::uint32_t code_point;\n    std::uint16_t offset;\n'
+      '    std::uint16_t length;\n};\n\n')
+    w('// Full canonical decompositions, sorted by code point (Hangul excluded).\n')
+    array('decomposition_entry', 'decompositions',
+          ['{0x%x, %d, %d}' % e for e in decomposition_entries], 4)
+    array('std::uint32_t', 'decomposition_pool', ['0x%x' % c for c in pool], 10)
+
+    w('// Primary composites keyed by (first << 21 | second), sorted (Hangul excluded).\n')
+    w('struct composition_entry\n{\n    std::uint64_t pair;\n    std::uint32_t composite;\n};\n\n')
+    array('composition_entry', 'compositions',
+          ['{0x%xull, 0x%x}' % ((a << 21) | b, c) for (a, b), c in sorted(compositions.items(),
+                                                                          key=lambda kv: (kv[0][0] << 21) | kv[0][1])], 3)
+
+    w('} // namespace unicode\n} // namespace detail\n} // namespace cinter\n')
+
+
+if __name__ == '__main__':
+    main()